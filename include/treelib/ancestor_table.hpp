@@ -0,0 +1,327 @@
+/********************************/
+#ifndef TRL_ANCESTOR_TABLE_HPP
+#define TRL_ANCESTOR_TABLE_HPP
+/********************************/
+/**
+ * @file    ancestor_table.hpp
+ * @date    16/10/2026
+ * @author  Julian Benzel
+ *
+ * @brief
+ * lowest-common-ancestor and level-ancestor queries on a trl::flex_tree.
+ *
+ * @details
+ * trl::ancestor_table numbers the nodes of a flex_tree in depth-first pre-order and keeps
+ * - the depth of every node, with a sparse-table over it that finds the shallowest node of any range of the order in O(1).
+ *   the lowest common ancestor of two nodes is the parent of the shallowest node behind the first one, up to the second one.
+ * - the nodes of every depth-layer in pre-order. the ancestor of a node on depth d is the last node of layer d in front of it,
+ *   found by binary search in O(log(n)).
+ * building it costs O(n * log(n)) time and memory, every query afterwards is independent of the depth of the tree,
+ * unlike walking the parent-links.
+ *
+ * the table is a snapshot of the structure of the tree, like a flat_flex_tree is one of it's values:
+ * every modification of the tree (or moving it) invalidates the table, rebuild() it afterwards.
+ * the tree counts it's modifications, so every query checks that the table is still current and throws std::logic_error
+ * (or asserts, without exceptions) otherwise, instead of answering from the old structure.
+ * trees that need always-current ancestor-tests rather than queries can use trl::flex_tree_policy::ancestor_index.
+ */
+/********************************/
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+#include "flex_tree.hpp"
+/********************************/
+
+namespace trl
+{
+
+    /**
+     * @brief answers lowest-common-ancestor and k-th-ancestor queries on a trl::flex_tree, built from it in O(n * log(n)).
+     * @tparam Type, Allocator, Policy the template-arguments of the flex_tree. only exceptions of the policy apply.
+     * @note queries take iterators of any traversal of the tree and return the same iterator-type.
+     *       the end()-iterator stands for the root of the tree, which is an ancestor of every node.
+     *       every query throws std::logic_error / asserts if the tree was modified after the table was (re)built.
+     */
+    template <typename Type, typename Allocator = std::allocator<Type>, typename Policy = flex_tree_policy>
+    class ancestor_table
+    {
+    protected:
+
+        using c_base_ptr_T_ = const detail__::flex_tree_node_base__<Policy>*;
+
+    public:
+
+        using tree_type = flex_tree<Type, Allocator, Policy>;
+        using size_type = std::size_t;
+
+        /**
+         * @name constructors
+         * @{
+         */
+
+        ancestor_table() = default;
+
+        /**
+         * @brief indexes every node of `tree`. O(n * log(n)).
+         */
+        explicit ancestor_table(const tree_type& tree)
+        { this->rebuild(tree); }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief forgets the previous tree and indexes every node of `tree`. O(n * log(n)).
+         */
+        void
+        rebuild(const tree_type& tree)
+        {
+            this->clear();
+            this->tree_M_ = &tree;
+            this->modifications_M_ = modifications_of_M_(tree);
+            this->header_M_ = tree.cend().node_ptr_M_();
+            this->nodes_M_.reserve(tree.size());
+            this->depths_M_.reserve(tree.size());
+            this->index_M_.reserve(tree.size());
+
+            c_base_ptr_T_ header__{this->header_M_};
+            if (!header__->has_children_M_())
+            { return; }
+            c_base_ptr_T_ iter__{header__->first_child_M_};
+            size_type depth__{1ull};
+            while (true)
+            {
+                size_type index__{this->nodes_M_.size()};
+                this->nodes_M_.push_back(iter__);
+                this->depths_M_.push_back(depth__);
+                this->index_M_.emplace(iter__, index__);
+                if (this->layers_M_.size() <= depth__)
+                { this->layers_M_.resize(depth__ + 1ull); }
+                this->layers_M_[depth__].push_back(index__);
+
+                if (iter__->has_children_M_())
+                { iter__ = iter__->first_child_M_; ++depth__; continue; }
+                while (iter__->is_last_child_M_())
+                {
+                    iter__ = iter__->parent_M_;
+                    --depth__;
+                    if (iter__ == header__) { this->build_sparse_table_M_(); return; }
+                }
+                iter__ = iter__->next_M_;
+            }
+        }
+
+        /**
+         * @brief forgets the indexed tree.
+         */
+        void
+        clear() noexcept
+        {
+            this->tree_M_ = nullptr;
+            this->modifications_M_ = 0ull;
+            this->header_M_ = nullptr;
+            this->nodes_M_.clear();
+            this->depths_M_.clear();
+            this->index_M_.clear();
+            this->layers_M_.clear();
+            this->shallowest_M_.clear();
+        }
+
+        /**
+         * @brief number of indexed nodes, the size of the tree when it was (re)built.
+         */
+        size_type
+        size() const noexcept
+        { return this->nodes_M_.size(); }
+
+        /**
+         * @brief true if the table was built from `tree` and the tree was not modified since.
+         */
+        bool
+        is_current(const tree_type& tree) const noexcept
+        { return this->tree_M_ == &tree && this->modifications_M_ == modifications_of_M_(tree); }
+
+        /**
+         * @name queries
+         * @{
+         */
+
+        /**
+         * @brief
+         * the lowest common ancestor of `a` and `b`: the deepest node that is `a` or an ancestor of `a`,
+         * and `b` or an ancestor of `b`. O(1).
+         * @return the end()-iterator, if the nodes only share the root.
+         * @note exceptions are thrown / the behaviour is undefined if:
+         * - `a` or `b` is not a node of the indexed tree.
+         */
+        template <typename IteratorType>
+        IteratorType
+        lca(IteratorType a, IteratorType b) const noexcept(!Policy::exceptions)
+        {
+            this->check_current_M_();
+            if (a.node_ptr_M_()->is_root_M_()) { return a; }
+            if (b.node_ptr_M_()->is_root_M_()) { return b; }
+            size_type first__{this->index_of_M_(a.node_ptr_M_())};
+            size_type last__{this->index_of_M_(b.node_ptr_M_())};
+            if (first__ == last__) { return a; }
+            if (first__ > last__) { std::swap(first__, last__); }
+            /* the nodes behind first__ up to last__ all lie below the lca, the shallowest of them is one of it's children */
+            c_base_ptr_T_ child__{this->nodes_M_[this->shallowest_in_M_(first__ + 1ull, last__)]};
+            return this->template make_iterator_M_<IteratorType>(child__->parent_M_);
+        }
+
+        /**
+         * @brief the k-th ancestor of `iter`: it's parent for k = 1, `iter` itself for k = 0. O(log(n)).
+         * @return the end()-iterator, if k is the depth of `iter`.
+         * @note exceptions are thrown / the behaviour is undefined if:
+         * - `iter` is not a node of the indexed tree.
+         * - `k` is greater than the depth of `iter`.
+         */
+        template <typename IteratorType>
+        IteratorType
+        ancestor(IteratorType iter, size_type k) const noexcept(!Policy::exceptions)
+        {
+            this->check_current_M_();
+            if (!k) { return iter; }
+            size_type depth__{this->depth_of_M_(iter.node_ptr_M_())};
+            if constexpr (Policy::exceptions)
+            { if (k > depth__) { throw std::out_of_range("'k' exceeds the depth of 'iter'"); } }
+            else
+            { assert(k <= depth__); }
+            return this->ancestor_at_depth(iter, depth__ - k);
+        }
+
+        /**
+         * @brief the ancestor of `iter` on depth `depth` (1 for top-level nodes). O(log(n)).
+         * @return the end()-iterator for depth 0, `iter` itself for it's own depth.
+         * @note exceptions are thrown / the behaviour is undefined if:
+         * - `iter` is not a node of the indexed tree.
+         * - `depth` is greater than the depth of `iter`.
+         */
+        template <typename IteratorType>
+        IteratorType
+        ancestor_at_depth(IteratorType iter, size_type depth) const noexcept(!Policy::exceptions)
+        {
+            this->check_current_M_();
+            if (!depth) { return this->template make_iterator_M_<IteratorType>(this->header_M_); }
+            size_type index__{this->index_of_M_(iter.node_ptr_M_())};
+            if constexpr (Policy::exceptions)
+            { if (depth > this->depths_M_[index__]) { throw std::out_of_range("'depth' exceeds the depth of 'iter'"); } }
+            else
+            { assert(depth <= this->depths_M_[index__]); }
+            /* the ancestor is the last node on it's layer that comes before iter in pre-order */
+            const std::vector<size_type>& layer__{this->layers_M_[depth]};
+            size_type ancestor__{*(std::upper_bound(layer__.begin(), layer__.end(), index__) - 1)};
+            return this->template make_iterator_M_<IteratorType>(this->nodes_M_[ancestor__]);
+        }
+
+        /**
+         * @brief depth of `iter` (0 for the end()-iterator) when the table was built. O(1).
+         * @note exceptions are thrown / the behaviour is undefined if:
+         * - `iter` is not a node of the indexed tree.
+         */
+        template <typename IteratorType>
+        size_type
+        depth(IteratorType iter) const noexcept(!Policy::exceptions)
+        {
+            this->check_current_M_();
+            return this->depth_of_M_(iter.node_ptr_M_());
+        }
+
+        /**
+         * @}
+         */
+
+    protected:
+
+        static size_type
+        modifications_of_M_(const tree_type& tree__) noexcept
+        { return static_cast<const detail__::flex_tree_header_node__<Policy>*>(tree__.cend().node_ptr_M_())->modifications_M_; }
+
+        void
+        check_current_M_() const noexcept(!Policy::exceptions)
+        {
+            if constexpr (Policy::exceptions)
+            { 
+                if (!this->tree_M_ || !this->is_current(*this->tree_M_)) 
+                { throw std::logic_error("the tree was modified after the table was built, rebuild() it"); } 
+            }
+            else
+            { assert(this->tree_M_ && this->is_current(*this->tree_M_)); }
+        }
+
+        size_type
+        index_of_M_(c_base_ptr_T_ node__) const noexcept(!Policy::exceptions)
+        {
+            typename std::unordered_map<c_base_ptr_T_, size_type>::const_iterator found__{this->index_M_.find(node__)};
+            if constexpr (Policy::exceptions)
+            { if (found__ == this->index_M_.end()) { throw std::invalid_argument("node is not part of the indexed tree, rebuild() the table"); } }
+            else
+            { assert(found__ != this->index_M_.end()); }
+            return found__->second;
+        }
+
+        size_type
+        depth_of_M_(c_base_ptr_T_ node__) const noexcept(!Policy::exceptions)
+        {
+            if (node__->is_root_M_()) { return 0ull; }
+            return this->depths_M_[this->index_of_M_(node__)];
+        }
+
+        /* shallowest_M_[level * size() + i] is the shallowest node in [i, i + 2^level) of the pre-order */
+        void
+        build_sparse_table_M_()
+        {
+            size_type count__{this->nodes_M_.size()};
+            size_type levels__{static_cast<size_type>(std::bit_width(count__))};
+            this->shallowest_M_.resize(levels__ * count__);
+            for (size_type i__{0ull}; i__ < count__; ++i__)
+            { this->shallowest_M_[i__] = i__; }
+            for (size_type level__{1ull}; level__ < levels__; ++level__)
+            {
+                size_type half__{1ull << (level__ - 1ull)};
+                const size_type* below__{this->shallowest_M_.data() + (level__ - 1ull) * count__};
+                size_type* row__{this->shallowest_M_.data() + level__ * count__};
+                for (size_type i__{0ull}; i__ + 2ull * half__ <= count__; ++i__)
+                { row__[i__] = this->shallower_M_(below__[i__], below__[i__ + half__]); }
+            }
+        }
+
+        /* the shallowest node in [first__, last__] of the pre-order, expects first__ <= last__ */
+        size_type
+        shallowest_in_M_(size_type first__, size_type last__) const noexcept
+        {
+            size_type level__{static_cast<size_type>(std::bit_width(last__ - first__ + 1ull)) - 1ull};
+            const size_type* row__{this->shallowest_M_.data() + level__ * this->nodes_M_.size()};
+            return this->shallower_M_(row__[first__], row__[last__ + 1ull - (1ull << level__)]);
+        }
+
+        size_type
+        shallower_M_(size_type a__, size_type b__) const noexcept
+        { return this->depths_M_[b__] < this->depths_M_[a__] ? b__ : a__; }
+
+        template <typename IteratorType>
+        IteratorType
+        make_iterator_M_(c_base_ptr_T_ node__) const noexcept
+        { return IteratorType(const_cast<decltype(std::declval<IteratorType>().node_ptr_M_())>(node__)); }
+
+        const tree_type* tree_M_{nullptr};
+        size_type modifications_M_{0ull};                  /* modification-count of the tree when the table was built */
+        c_base_ptr_T_ header_M_{nullptr};
+        std::vector<c_base_ptr_T_> nodes_M_;               /* every node in pre-order */
+        std::vector<size_type> depths_M_;                  /* depth of every node in pre-order */
+        std::unordered_map<c_base_ptr_T_, size_type> index_M_; /* position of every node in pre-order */
+        std::vector<std::vector<size_type>> layers_M_;     /* positions of the nodes of every depth-layer, ascending */
+        std::vector<size_type> shallowest_M_;
+    };
+
+}
+
+#endif
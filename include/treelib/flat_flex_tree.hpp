@@ -1,26 +1,42 @@
+/********************************/
 #ifndef TRL_FLAT_FLEX_TREE_HPP
 #define TRL_FLAT_FLEX_TREE_HPP
-
+/********************************/
 /**
  * @file    flat_flex_tree.hpp
  * @date    25/08/2025
  * @author  Julian Benzel
  *
  * @brief
- * C++ STL-like implementation of an n-ary tree data-structure.
+ * C++ STL-like implementation of a flexible arbitrary-ary tree-data-structure, stored in contiguous arrays.
  *
  * @details
- * 
+ * trl::flat_flex_tree keeps the values of it's nodes in a single array in depth-first pre-order, next to parallel
+ * arrays holding the subtree-size, depth and parent-index of every node. pre-order iteration is a walk over the array
+ * and the structure-queries of node_traits are index-arithmetic, nothing is chased through pointers.
+ * the price are modifications: inserting or erasing a node shifts every node behind it, which costs O(n).
+ * meant for read-mostly trees that are built once (e.g. from a trl::flex_tree) and traversed many times.
+ *
+ * it offers the same iterators and node_traits as trl::flex_tree, with the same traversal-orders, and takes the
+ * same policy (trl::flex_tree_policy) for it's exceptions and default traversal. the node-layout members of the policy
+ * have no effect, the structure of a node is always it's subtree-size, depth and parent-index.
  *
+ * iterators are positions in the arrays: every modification invalidates the iterators behind the modified position,
+ * just like std::vector.
  */
 /********************************/
-#include <concepts>
+#include <cstddef>
 #include <memory>
 #include <iterator>
 #include <initializer_list>
-#include <stdexcept>
 #include <type_traits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <algorithm>
 #include <cassert>
+
+#include "flex_tree.hpp"
 /********************************/
 
 namespace trl
@@ -28,16 +44,1502 @@ namespace trl
 
     namespace detail__
     {
+        /**
+         * @brief
+         * the arrays of a flat_flex_tree. node i is described by the i-th entry of every array,
+         * and the index size() acts as the valueless root of the tree (the end()-position).
+         */
+        template <typename ValTp__, typename Alloc__>
+        struct flat_flex_tree_impl__
+        {
+            static_assert(!std::is_same_v<ValTp__, bool>, "trl::flat_flex_tree: std::vector<bool> does not hold addressable values");
+
+            using value_type = ValTp__;
+            using value_alloc_T_ = typename std::allocator_traits<Alloc__>::template rebind_alloc<ValTp__>;
+            using index_alloc_T_ = typename std::allocator_traits<Alloc__>::template rebind_alloc<std::size_t>;
+            using index_array_T_ = std::vector<std::size_t, index_alloc_T_>;
+
+            /* parent-index of top-level nodes. not size(), which would change with every insertion */
+            static constexpr std::size_t npos_M_{static_cast<std::size_t>(-1)};
+
+            /* the values in pre-order */
+            std::vector<ValTp__, value_alloc_T_> values_M_;
+            /* nodes in the subtree of a node, including itself. the subtree of i is [i, i + subtree_sizes_M_[i]) */
+            index_array_T_ subtree_sizes_M_;
+            /* 1 for top-level nodes, like flex_tree's node_traits::depth() */
+            index_array_T_ depths_M_;
+            /* index of the parent-node, npos_M_ for top-level nodes */
+            index_array_T_ parents_M_;
+
+            explicit flat_flex_tree_impl__(const Alloc__& alloc__)
+                : values_M_(value_alloc_T_(alloc__))
+                , subtree_sizes_M_(index_alloc_T_(alloc__))
+                , depths_M_(index_alloc_T_(alloc__))
+                , parents_M_(index_alloc_T_(alloc__))
+            { }
+
+            /**
+             * @name structure-queries. i__ == size_M_() is the root.
+             * @{
+             */
+
+            std::size_t
+            size_M_() const noexcept
+            { return this->values_M_.size(); }
+
+            bool
+            is_root_M_(std::size_t i__) const noexcept
+            { return i__ == this->size_M_(); }
+
+            /* one past the last node in the subtree of i__ */
+            std::size_t
+            subtree_end_M_(std::size_t i__) const noexcept
+            { return this->is_root_M_(i__) ? i__ : i__ + this->subtree_sizes_M_[i__]; }
+
+            std::size_t
+            depth_M_(std::size_t i__) const noexcept
+            { return this->is_root_M_(i__) ? 0ull : this->depths_M_[i__]; }
+
+            /* the root is it's own parent, like the header of a flex_tree */
+            std::size_t
+            parent_M_(std::size_t i__) const noexcept
+            {
+                if (this->is_root_M_(i__) || this->parents_M_[i__] == npos_M_)
+                { return this->size_M_(); }
+                return this->parents_M_[i__];
+            }
+
+            bool
+            has_children_M_(std::size_t i__) const noexcept
+            { return this->is_root_M_(i__) ? this->size_M_() != 0ull : this->subtree_sizes_M_[i__] > 1ull; }
+
+            /* expects i__ to have child-nodes */
+            std::size_t
+            first_child_M_(std::size_t i__) const noexcept
+            { return this->is_root_M_(i__) ? 0ull : i__ + 1ull; }
+
+            /* the next sibling, if there is one, directly follows the subtree of i__ on the same depth */
+            bool
+            has_next_M_(std::size_t i__) const noexcept
+            {
+                if (this->is_root_M_(i__))
+                { return false; }
+                std::size_t next__{i__ + this->subtree_sizes_M_[i__]};
+                return next__ < this->size_M_() && this->depths_M_[next__] == this->depths_M_[i__];
+            }
+
+            /* expects has_next_M_(i__) */
+            std::size_t
+            next_M_(std::size_t i__) const noexcept
+            { return i__ + this->subtree_sizes_M_[i__]; }
+
+            bool
+            is_last_child_M_(std::size_t i__) const noexcept
+            { return !this->has_next_M_(i__); }
+
+            /* the node in front of a first child is it's parent */
+            bool
+            is_first_child_M_(std::size_t i__) const noexcept
+            { return this->is_root_M_(i__) || !i__ || this->depths_M_[i__ - 1ull] < this->depths_M_[i__]; }
+
+            bool
+            is_only_child_M_(std::size_t i__) const noexcept
+            { return !this->is_root_M_(i__) && this->is_first_child_M_(i__) && this->is_last_child_M_(i__); }
+
+            /*
+             * expects i__ not to be a first child. the node in front of i__ is the last node in the subtree
+             * of the previous sibling, which is climbed up to the depth of i__. O(depth-difference).
+             */
+            std::size_t
+            prev_M_(std::size_t i__) const noexcept
+            {
+                std::size_t prev__{i__ - 1ull};
+                while (this->depths_M_[prev__] != this->depths_M_[i__])
+                { prev__ = this->parents_M_[prev__]; }
+                return prev__;
+            }
+
+            /* expects i__ to have child-nodes. climbs up from the last node in the subtree, O(depth-difference). */
+            std::size_t
+            last_child_M_(std::size_t i__) const noexcept
+            {
+                std::size_t parent__{this->is_root_M_(i__) ? npos_M_ : i__};
+                std::size_t last__{this->subtree_end_M_(i__) - 1ull};
+                while (this->parents_M_[last__] != parent__)
+                { last__ = this->parents_M_[last__]; }
+                return last__;
+            }
+
+            std::size_t
+            child_count_M_(std::size_t i__) const noexcept
+            {
+                std::size_t res__{0ull};
+                if (!this->has_children_M_(i__))
+                { return res__; }
+                for (std::size_t child__{this->first_child_M_(i__)}; child__ < this->subtree_end_M_(i__); child__ += this->subtree_sizes_M_[child__])
+                { ++res__; }
+                return res__;
+            }
+
+            /**
+             * @}
+             */
+
+            /**
+             * @name modifications.
+             * @{
+             */
+
+            /**
+             * constructs a node at pos__ as a child of parent__ (npos_M_ for top-level nodes).
+             * every node behind it moves back by one, so the parent-indices behind it are shifted and the ancestors grow.
+             */
+            template <typename... Args__>
+            void
+            insert_M_(std::size_t pos__, std::size_t parent__, std::size_t depth__, Args__&&... args__)
+            {
+                this->values_M_.emplace(this->values_M_.begin() + pos__, std::forward<Args__>(args__)...);
+                this->subtree_sizes_M_.insert(this->subtree_sizes_M_.begin() + pos__, 1ull);
+                this->depths_M_.insert(this->depths_M_.begin() + pos__, depth__);
+                this->parents_M_.insert(this->parents_M_.begin() + pos__, parent__);
+                for (std::size_t i__{pos__ + 1ull}; i__ < this->size_M_(); ++i__)
+                {
+                    if (this->parents_M_[i__] != npos_M_ && this->parents_M_[i__] >= pos__)
+                    { ++this->parents_M_[i__]; }
+                }
+                for (std::size_t ancestor__{parent__}; ancestor__ != npos_M_; ancestor__ = this->parents_M_[ancestor__])
+                { ++this->subtree_sizes_M_[ancestor__]; }
+            }
+
+            /**
+             * erases the subtree of i__.
+             * @return the number of erased nodes.
+             */
+            std::size_t
+            erase_M_(std::size_t i__)
+            {
+                std::size_t count__{this->subtree_sizes_M_[i__]};
+                for (std::size_t ancestor__{this->parents_M_[i__]}; ancestor__ != npos_M_; ancestor__ = this->parents_M_[ancestor__])
+                { this->subtree_sizes_M_[ancestor__] -= count__; }
+                this->values_M_.erase(this->values_M_.begin() + i__, this->values_M_.begin() + i__ + count__);
+                this->subtree_sizes_M_.erase(this->subtree_sizes_M_.begin() + i__, this->subtree_sizes_M_.begin() + i__ + count__);
+                this->depths_M_.erase(this->depths_M_.begin() + i__, this->depths_M_.begin() + i__ + count__);
+                this->parents_M_.erase(this->parents_M_.begin() + i__, this->parents_M_.begin() + i__ + count__);
+                for (std::size_t j__{i__}; j__ < this->size_M_(); ++j__)
+                {
+                    if (this->parents_M_[j__] != npos_M_ && this->parents_M_[j__] > i__)
+                    { this->parents_M_[j__] -= count__; }
+                }
+                return count__;
+            }
+
+            void
+            clear_M_() noexcept
+            {
+                this->values_M_.clear();
+                this->subtree_sizes_M_.clear();
+                this->depths_M_.clear();
+                this->parents_M_.clear();
+            }
+
+            void
+            reserve_M_(std::size_t count__)
+            {
+                this->values_M_.reserve(count__);
+                this->subtree_sizes_M_.reserve(count__);
+                this->depths_M_.reserve(count__);
+                this->parents_M_.reserve(count__);
+            }
+
+            /**
+             * appends the nodes described by ilist__ as the last children of parent__ on depth__,
+             * which have to be the last nodes in pre-order.
+             * @return the number of appended nodes.
+             */
+            template <typename Init__>
+            std::size_t
+            build_M_(std::initializer_list<Init__> ilist__, std::size_t parent__, std::size_t depth__)
+            {
+                std::size_t nodes_affected__{0ull};
+                for (const Init__& init__ : ilist__)
+                {
+                    std::size_t index__{this->size_M_()};
+                    init__.emplace_node_M_(*this);
+                    this->subtree_sizes_M_.push_back(1ull);
+                    this->depths_M_.push_back(depth__);
+                    this->parents_M_.push_back(parent__);
+                    if (init__.children_M_.size())
+                    { this->subtree_sizes_M_[index__] += this->build_M_(init__.children_M_, index__, depth__ + 1ull); }
+                    nodes_affected__ += this->subtree_sizes_M_[index__];
+                }
+                return nodes_affected__;
+            }
+
+            /**
+             * @}
+             */
+        };
+
+        /**
+         * @brief
+         * describes one node of a flat_flex_tree and it's child-nodes in an initializer-list.
+         * like flex_tree's initializer, it only refers to the constructor-arguments, the value is constructed in place.
+         */
+        template <typename Impl__>
+        struct flat_flex_tree_node_initializer__
+        {
+            using value_T_ = typename Impl__::value_type;
+
+            static constexpr std::size_t max_args_M_{4ull};
+
+            /* type-erased addresses of the constructor-arguments, and the function that knows their types */
+            const void* args_M_[max_args_M_]{};
+            void (*emplace_M_)(Impl__&, const void* const*){nullptr};
+            std::initializer_list<flat_flex_tree_node_initializer__> children_M_{};
+
+            /* non-copyable, it refers to temporaries */
+            flat_flex_tree_node_initializer__(const flat_flex_tree_node_initializer__&) = delete;
+            flat_flex_tree_node_initializer__& operator=(const flat_flex_tree_node_initializer__&) = delete;
+
+            template <typename... Args>
+                requires (sizeof...(Args) <= max_args_M_) && std::constructible_from<value_T_, Args...>
+            flat_flex_tree_node_initializer__(Args&&... args__)
+                : args_M_{ static_cast<const void*>(std::addressof(args__))... }
+                , emplace_M_(&emplace_from_M_<Args...>)
+            { }
+
+            template <typename Arg>
+                requires std::constructible_from<value_T_, Arg>
+            flat_flex_tree_node_initializer__(Arg&& arg__, std::initializer_list<flat_flex_tree_node_initializer__> ilist__)
+                : args_M_{ static_cast<const void*>(std::addressof(arg__)) }
+                , emplace_M_(&emplace_from_M_<Arg>)
+                , children_M_(ilist__)
+            { }
+
+            /**
+             * @brief constructs the value this initializer describes behind the last value of impl__.
+             */
+            void
+            emplace_node_M_(Impl__& impl__) const
+            { this->emplace_M_(impl__, this->args_M_); }
+
+            template <typename... Args>
+            static void
+            emplace_from_M_(Impl__& impl__, const void* const* args__)
+            { emplace_from_M_<Args...>(impl__, args__, std::index_sequence_for<Args...>{}); }
+
+            template <typename... Args, std::size_t... Idx>
+            static void
+            emplace_from_M_(Impl__& impl__, const void* const* args__, std::index_sequence<Idx...>)
+            {
+                impl__.values_M_.emplace_back(
+                    std::forward<Args>(*static_cast<std::remove_reference_t<Args>*>(const_cast<void*>(args__[Idx])))...);
+            }
+        };
+
+        template <typename Impl__, typename Policy__, bool Const__>
+        struct flat_flex_tree_iterator_base__
+        {
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = typename std::conditional<Const__, const typename Impl__::value_type, typename Impl__::value_type>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = value_type*;
+            using reference = value_type&;
+
+            using self_T_ = flat_flex_tree_iterator_base__;
+            using policy_T_ = Policy__;
+            using impl_T_ = Impl__;
+            using impl_ptr_T_ = typename std::conditional<Const__, const Impl__*, Impl__*>::type;
+
+            impl_ptr_T_ impl_M_{nullptr};
+            std::size_t index_M_{0ull};
+
+            flat_flex_tree_iterator_base__() = default;
+
+            flat_flex_tree_iterator_base__(impl_ptr_T_ impl__, std::size_t index__) noexcept
+                : impl_M_(impl__)
+                , index_M_(index__)
+            { }
+
+            /**
+             * @name node-value accessors.
+             * @{
+             */
+
+            [[nodiscard]]
+            reference
+            operator*() const noexcept(!Policy__::iterator_exceptions)
+            {
+                if constexpr (Policy__::iterator_exceptions)
+                { if (this->impl_M_->is_root_M_(this->index_M_)) { throw std::logic_error("cannot dereference end()-iterator"); } }
+                else
+                { assert(!this->impl_M_->is_root_M_(this->index_M_)); /* out of bounds of the value-array. check only in debug. */ }
+                return this->impl_M_->values_M_[this->index_M_];
+            }
+
+            [[nodiscard]]
+            pointer
+            operator->() const noexcept(!Policy__::iterator_exceptions)
+            { return std::addressof(**this); }
+
+            /**
+             * @}
+             */
+
+            /**
+             * @name equality-operators. all iterators are comparable via the node they point to.
+             * @{
+             */
+
+            friend bool
+            operator==(const self_T_& a, const self_T_& b)
+            { return a.index_M_ == b.index_M_ && a.impl_M_ == b.impl_M_; }
+
+            friend bool /* can be omitted as of C++20 */
+            operator!=(const self_T_& a, const self_T_& b)
+            { return !(a == b); }
+
+            /**
+             * @}
+             */
+        };
+
+        /**
+         * @brief an iterator to a flat_flex_tree.
+         * @tparam Trav__ the traversal-algorithm used by the iterator.
+         */
+        template <traversal Trav__, typename Impl__, typename Policy__, bool Const__>
+        struct flat_flex_tree_iterator__; /* primary template. not to be instantiated. */
+
+        /**
+         * @brief partial-specialization for depth-first pre-order traversal, which is the order of the arrays.
+         */
+        template <typename Impl__, typename Policy__, bool Const__>
+        struct flat_flex_tree_iterator__<depth_first_pre_order, Impl__, Policy__, Const__>
+            : public flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>
+        {
+            using self_T_ = flat_flex_tree_iterator__<depth_first_pre_order, Impl__, Policy__, Const__>;
+            using base_T_ = flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>;
+            using base_T_::base_T_; /* use constructors of base-class */
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            flat_flex_tree_iterator__(const flat_flex_tree_iterator_base__<Impl__, Policy__, false>& other) noexcept
+                requires Const__
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            flat_flex_tree_iterator__(const flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>& other) noexcept
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            /**
+             * @return the index of the first node in pre-order, or the root if the tree is empty.
+             */
+            static std::size_t
+            first_M_(const Impl__&) noexcept
+            { return 0ull; }
+
+            self_T_&
+            operator++() noexcept
+            {
+                this->index_M_ = this->impl_M_->is_root_M_(this->index_M_) ? 0ull : this->index_M_ + 1ull;
+                return *this;
+            }
+
+            self_T_&
+            operator--() noexcept
+            {
+                this->index_M_ = this->index_M_ ? this->index_M_ - 1ull : this->impl_M_->size_M_();
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; --(*this); return old; }
+        };
+
+        /**
+         * @brief partial-specialization for depth-first post-order traversal.
+         */
+        template <typename Impl__, typename Policy__, bool Const__>
+        struct flat_flex_tree_iterator__<depth_first_post_order, Impl__, Policy__, Const__>
+            : public flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>
+        {
+            using self_T_ = flat_flex_tree_iterator__<depth_first_post_order, Impl__, Policy__, Const__>;
+            using base_T_ = flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>;
+            using base_T_::base_T_; /* use constructors of base-class */
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            flat_flex_tree_iterator__(const flat_flex_tree_iterator_base__<Impl__, Policy__, false>& other) noexcept
+                requires Const__
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            flat_flex_tree_iterator__(const flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>& other) noexcept
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            /* the first child of a node directly follows it */
+            static std::size_t
+            leftmost_leaf_M_(const Impl__& impl__, std::size_t i__) noexcept
+            {
+                while (impl__.has_children_M_(i__))
+                { i__ = impl__.first_child_M_(i__); }
+                return i__;
+            }
+
+            /**
+             * @return the index of the first node in post-order, or the root if the tree is empty.
+             */
+            static std::size_t
+            first_M_(const Impl__& impl__) noexcept
+            { return leftmost_leaf_M_(impl__, impl__.size_M_()); }
+
+            self_T_&
+            operator++() noexcept
+            {
+                const Impl__& impl__{*this->impl_M_};
+                if (impl__.is_root_M_(this->index_M_))
+                { this->index_M_ = first_M_(impl__); }
+                else if (impl__.has_next_M_(this->index_M_))
+                { this->index_M_ = leftmost_leaf_M_(impl__, impl__.next_M_(this->index_M_)); }
+                else
+                { this->index_M_ = impl__.parent_M_(this->index_M_); }
+                return *this;
+            }
+
+            self_T_&
+            operator--() noexcept
+            {
+                const Impl__& impl__{*this->impl_M_};
+                if (impl__.has_children_M_(this->index_M_))
+                { this->index_M_ = impl__.last_child_M_(this->index_M_); return *this; }
+                while (impl__.is_first_child_M_(this->index_M_) && !impl__.is_root_M_(this->index_M_))
+                { this->index_M_ = impl__.parent_M_(this->index_M_); }
+                if (!impl__.is_root_M_(this->index_M_))
+                { this->index_M_ = impl__.prev_M_(this->index_M_); }
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; --(*this); return old; }
+        };
+
+        /**
+         * @brief
+         * partial-specialization for breadth-first traversal.
+         * @details
+         * visits the nodes in the same alternating order as flex_tree's breadth-first iterators. a depth-layer is
+         * not contiguous in the arrays, so like flex_tree's iterator for trees without layer-links (see trl::flex_tree_policy)
+         * it keeps two stacks: the rest of the current layer in visiting order, and the child-nodes of the already visited nodes,
+         * pushed so that the next layer pops off in the opposite direction. a step costs amortized O(1), but the iterator
+         * owns O(width) memory, it is a forward-iterator only, and any modification of the tree invalidates it.
+         * constructing it from a plain position has to collect the layer of that position once.
+         */
+        template <traversal Trav__, typename Impl__, typename Policy__, bool Const__>
+            requires (Trav__ == breadth_first_in_order || Trav__ == breadth_first_reverse_order)
+        struct flat_flex_tree_iterator__<Trav__, Impl__, Policy__, Const__>
+            : public flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>
+        {
+            using iterator_category = std::forward_iterator_tag;
+            using self_T_ = flat_flex_tree_iterator__<Trav__, Impl__, Policy__, Const__>;
+            using base_T_ = flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>;
+            using impl_ptr_T_ = typename base_T_::impl_ptr_T_;
+
+            static constexpr bool reversed_M_{Trav__ == breadth_first_reverse_order};
+
+            /* true while the current layer is walked left-to-right, the root counts as depth 0 */
+            bool direction_M_{reversed_M_};
+            /* the nodes of the current layer that are still to be visited, the next one on top */
+            std::vector<std::size_t> layer_M_{};
+            /* the child-nodes of the visited nodes of the current layer */
+            std::vector<std::size_t> next_layer_M_{};
+
+            flat_flex_tree_iterator__() = default;
+
+            flat_flex_tree_iterator__(impl_ptr_T_ impl__, std::size_t index__)
+                : base_T_(impl__, index__)
+            {
+                if (impl__ && !impl__->is_root_M_(index__))
+                { this->seek_M_(); }
+            }
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            flat_flex_tree_iterator__(const flat_flex_tree_iterator__<Trav__, Impl__, Policy__, false>& other)
+                requires Const__
+                : base_T_(other.impl_M_, other.index_M_)
+                , direction_M_(other.direction_M_)
+                , layer_M_(other.layer_M_)
+                , next_layer_M_(other.next_layer_M_)
+            { }
+
+            flat_flex_tree_iterator__(const flat_flex_tree_iterator_base__<Impl__, Policy__, false>& other)
+                requires Const__
+                : flat_flex_tree_iterator__(other.impl_M_, other.index_M_)
+            { }
+
+            flat_flex_tree_iterator__(const flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>& other)
+                : flat_flex_tree_iterator__(other.impl_M_, other.index_M_)
+            { }
+
+            /**
+             * @return the index of the first node in breadth-first-order, or the root if the tree is empty.
+             */
+            static std::size_t
+            first_M_(const Impl__& impl__) noexcept
+            {
+                std::size_t first__{0ull};
+                if constexpr (reversed_M_)
+                {
+                    if (impl__.has_children_M_(impl__.size_M_()))
+                    { first__ = impl__.last_child_M_(impl__.size_M_()); }
+                }
+                return first__;
+            }
+
+            self_T_&
+            operator++()
+            {
+                this->push_children_M_(this->index_M_);
+                if (this->layer_M_.empty())
+                {
+                    if (this->next_layer_M_.empty())
+                    {
+                        this->index_M_ = this->impl_M_->size_M_();
+                        this->direction_M_ = reversed_M_;
+                        return *this;
+                    }
+                    this->layer_M_.swap(this->next_layer_M_);
+                    this->direction_M_ = !this->direction_M_;
+                }
+                this->index_M_ = this->layer_M_.back();
+                this->layer_M_.pop_back();
+                return *this;
+            }
+
+            self_T_
+            operator++(int)
+            { self_T_ old{*this}; ++(*this); return old; }
+
+        private:
+
+            /*
+             * pushes the child-nodes of a visited node in the direction of it's layer.
+             * the next layer is walked the other way around, so it pops off in the right order.
+             */
+            void
+            push_children_M_(std::size_t i__)
+            {
+                const Impl__& impl__{*this->impl_M_};
+                if (!impl__.has_children_M_(i__))
+                { return; }
+                std::size_t pushed__{this->next_layer_M_.size()};
+                for (std::size_t child__{impl__.first_child_M_(i__)}; child__ < impl__.subtree_end_M_(i__); child__ += impl__.subtree_sizes_M_[child__])
+                { this->next_layer_M_.push_back(child__); }
+                if (!this->direction_M_)
+                { std::reverse(this->next_layer_M_.begin() + pushed__, this->next_layer_M_.end()); }
+            }
+
+            /*
+             * restores the stacks for a position that was not reached by iteration: collects it's layer, which appears
+             * left-to-right in pre-order, pushes the children of the nodes visited before it and queues the ones after it.
+             */
+            void
+            seek_M_()
+            {
+                const Impl__& impl__{*this->impl_M_};
+                std::size_t depth__{impl__.depth_M_(this->index_M_)};
+                std::vector<std::size_t> layer__;
+                for (std::size_t i__{0ull}; i__ < impl__.size_M_(); )
+                {
+                    if (impl__.depths_M_[i__] == depth__)
+                    { layer__.push_back(i__); i__ = impl__.subtree_end_M_(i__); }
+                    else
+                    { ++i__; }
+                }
+
+                this->direction_M_ = static_cast<bool>(depth__ % 2) != reversed_M_;
+                if (!this->direction_M_) /* layer__ in visiting order */
+                { std::reverse(layer__.begin(), layer__.end()); }
+                auto where__ = std::find(layer__.begin(), layer__.end(), this->index_M_);
+                for (auto iter__ = layer__.begin(); iter__ != where__; ++iter__)
+                { this->push_children_M_(*iter__); }
+                this->layer_M_.assign(layer__.rbegin(), std::make_reverse_iterator(where__ + 1));
+            }
+        };
+
+        /**
+         * @details
+         * reverse-iterator adaptor for flat_flex_tree::iterator. like flex_tree's, it points at the node it dereferences,
+         * instead of one behind it like std::reverse_iterator.
+         */
+        template <typename Iter__>
+        struct flat_flex_tree_reverse_iterator__
+        {
+            using base_type = Iter__;
+            using iterator_category = typename base_type::iterator_category;
+            using value_type = typename base_type::value_type;
+            using difference_type = typename base_type::difference_type;
+            using pointer = typename base_type::pointer;
+            using reference = typename base_type::reference;
+
+            using self_T_ = flat_flex_tree_reverse_iterator__;
+            using self_ref_T_ = self_T_&;
+            using c_self_ref_T_ = const self_T_&;
+
+            base_type instance_M_;
+
+            flat_flex_tree_reverse_iterator__() = default;
+
+            flat_flex_tree_reverse_iterator__(const base_type& iter) noexcept
+                : instance_M_(iter)
+            { }
+
+            /* const-promotion, the same way the underlying iterators are promoted */
+            template <typename OtherIter__>
+                requires (!std::is_same_v<OtherIter__, Iter__>) && std::constructible_from<Iter__, const OtherIter__&>
+            flat_flex_tree_reverse_iterator__(const flat_flex_tree_reverse_iterator__<OtherIter__>& other) noexcept
+                : instance_M_(other.instance_M_)
+            { }
+
+            base_type&
+            base()
+            { return this->instance_M_; }
+
+            const base_type&
+            base() const
+            { return this->instance_M_; }
+
+            self_ref_T_
+            operator++() noexcept
+            { --this->instance_M_; return *this; }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; --this->instance_M_; return old; }
+
+            self_ref_T_
+            operator--() noexcept
+            { ++this->instance_M_; return *this; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; ++this->instance_M_; return old; }
+
+            [[nodiscard]]
+            reference
+            operator*() const noexcept(noexcept(*std::declval<const base_type&>()))
+            { return *this->instance_M_; }
+
+            [[nodiscard]]
+            pointer
+            operator->() const noexcept(noexcept(*std::declval<const base_type&>()))
+            { return std::addressof(*this->instance_M_); }
+
+            friend bool
+            operator==(c_self_ref_T_ a, c_self_ref_T_ b)
+            { return a.instance_M_ == b.instance_M_; }
+
+            friend bool
+            operator!=(c_self_ref_T_ a, c_self_ref_T_ b)
+            { return a.instance_M_ != b.instance_M_; }
+        };
+
+        /**
+         * @brief
+         * iterates over the child-nodes of a node, like flex_tree's leaf_iterator.
+         * to be used with `trl::flat_flex_tree<>::node_traits::lbegin()`/`lend()`.
+         */
+        template <typename Impl__, typename Policy__, bool Const__>
+        struct flat_flex_tree_leaf_iterator__
+            : public flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>
+        {
+            using self_T_ = flat_flex_tree_leaf_iterator__;
+            using base_T_ = flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>;
+            using base_T_::base_T_; /* use constructors of base-class */
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            flat_flex_tree_leaf_iterator__(const flat_flex_tree_iterator_base__<Impl__, Policy__, false>& other) noexcept
+                requires Const__
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            flat_flex_tree_leaf_iterator__(const flat_flex_tree_iterator_base__<Impl__, Policy__, Const__>& other) noexcept
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            self_T_&
+            operator++() noexcept
+            {
+                this->index_M_ = this->impl_M_->is_last_child_M_(this->index_M_) ?
+                    this->impl_M_->parent_M_(this->index_M_) : this->impl_M_->next_M_(this->index_M_);
+                return *this;
+            }
 
+            self_T_&
+            operator--() noexcept
+            {
+                this->index_M_ = this->impl_M_->is_first_child_M_(this->index_M_) ?
+                    this->impl_M_->parent_M_(this->index_M_) : this->impl_M_->prev_M_(this->index_M_);
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; --(*this); return old; }
+        };
+
+        /**
+         * @brief
+         * provides (optionally exception-safe) information about a node's placement in a flat_flex_tree.
+         * next/previous refer to siblings, like in a flex_tree without layer-links.
+         */
+        template <typename Policy__>
+        struct flat_flex_tree_node_traits__
+        {
+
+            template <typename IteratorType>
+            static IteratorType
+            parent(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.impl_M_->is_root_M_(iter.index_M_)) { throw std::logic_error("root-node cannot have a parent-node"); } }
+                else
+                { assert(!iter.impl_M_->is_root_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->parent_M_(iter.index_M_));
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            next(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (!iter.impl_M_->has_next_M_(iter.index_M_)) { throw std::logic_error("node does not have a next node"); } }
+                else
+                { assert(iter.impl_M_->has_next_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->next_M_(iter.index_M_));
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            previous(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.impl_M_->is_first_child_M_(iter.index_M_)) { throw std::logic_error("node does not have a previous node"); } }
+                else
+                { assert(!iter.impl_M_->is_first_child_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->prev_M_(iter.index_M_));
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            first_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (!iter.impl_M_->has_children_M_(iter.index_M_)) { throw std::logic_error("node does not have any child-nodes"); } }
+                else
+                { assert(iter.impl_M_->has_children_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->first_child_M_(iter.index_M_));
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            last_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (!iter.impl_M_->has_children_M_(iter.index_M_)) { throw std::logic_error("node does not have any child-nodes"); } }
+                else
+                { assert(iter.impl_M_->has_children_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->last_child_M_(iter.index_M_));
+            }
+
+            template <typename IteratorType>
+            static std::size_t
+            depth(IteratorType iter) noexcept
+            { return iter.impl_M_->depth_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static std::size_t
+            child_count(IteratorType iter) noexcept
+            { return iter.impl_M_->child_count_M_(iter.index_M_); }
+
+            /* number of nodes in the subtree of iter, including itself. the root counts every node. */
+            template <typename IteratorType>
+            static std::size_t
+            subtree_size(IteratorType iter) noexcept
+            {
+                return iter.impl_M_->is_root_M_(iter.index_M_) ?
+                    iter.impl_M_->size_M_() : iter.impl_M_->subtree_sizes_M_[iter.index_M_];
+            }
+
+            template <typename IteratorType>
+            static bool
+            is_root(IteratorType iter) noexcept
+            { return iter.impl_M_->is_root_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            is_first_child(IteratorType iter) noexcept
+            { return iter.impl_M_->is_first_child_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            is_last_child(IteratorType iter) noexcept
+            { return iter.impl_M_->is_last_child_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            has_next(IteratorType iter) noexcept
+            { return iter.impl_M_->has_next_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            has_previous(IteratorType iter) noexcept
+            { return !iter.impl_M_->is_first_child_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            has_children(IteratorType iter) noexcept
+            { return iter.impl_M_->has_children_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            is_only_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.impl_M_->is_root_M_(iter.index_M_)) { throw std::logic_error("root-node cannot be a child-node"); } }
+                else
+                { assert(!iter.impl_M_->is_root_M_(iter.index_M_)); }
+                return iter.impl_M_->is_only_child_M_(iter.index_M_);
+            }
+
+            template <typename IterTp__>
+            using leaf_iter_T_ = flat_flex_tree_leaf_iterator__<typename IterTp__::impl_T_, typename IterTp__::policy_T_, std::is_const_v<typename IterTp__::value_type>>;
+
+            template <typename IteratorType>
+            static leaf_iter_T_<IteratorType>
+            lbegin(IteratorType iter) noexcept(!Policy__::exceptions)
+            { return leaf_iter_T_<IteratorType>(iter.impl_M_, first_child(iter).index_M_); }
+
+            template <typename IteratorType>
+            static leaf_iter_T_<IteratorType>
+            lend(IteratorType iter) noexcept
+            { return leaf_iter_T_<IteratorType>(iter.impl_M_, iter.index_M_); }
+
+        };
     }
 
-    template <typename Type, std::size_t Size, 
-            typename Allocator = std::allocator<Type>>
+    /**
+     * @brief C++ STL-like implementation of a flexible arbitrary-ary tree-data-structure, stored in contiguous arrays.
+     * @tparam Type the type that every node should contain.
+     * @tparam Allocator an allocator type, rebound for the value- and structure-arrays.
+     * @tparam Policy compile-time configuration of the tree, see trl::flex_tree_policy. only exceptions, iterator_exceptions
+     *         and default_traversal apply.
+     */
+    template <typename Type, typename Allocator = std::allocator<Type>, typename Policy = flex_tree_policy>
     class flat_flex_tree
     {
+    protected:
+
+        using impl_T_ = detail__::flat_flex_tree_impl__<Type, Allocator>;
+
+    public:
+
+        static constexpr traversal default_traversal = Policy::default_traversal;
+
+        using value_type = Type;
+        using allocator_type = Allocator;
+        using policy_type = Policy;
+        using initializer_type = detail__::flat_flex_tree_node_initializer__<impl_T_>;
+
+        template <traversal Traversal = default_traversal>
+        using iterator = detail__::flat_flex_tree_iterator__<Traversal, impl_T_, Policy, false>;
+
+        template <traversal Traversal = default_traversal>
+        using const_iterator = detail__::flat_flex_tree_iterator__<Traversal, impl_T_, Policy, true>;
+
+        template <traversal Traversal = default_traversal>
+        using reverse_iterator = detail__::flat_flex_tree_reverse_iterator__<iterator<Traversal>>;
+
+        template <traversal Traversal = default_traversal>
+        using const_reverse_iterator = detail__::flat_flex_tree_reverse_iterator__<const_iterator<Traversal>>;
+
+        using leaf_iterator = detail__::flat_flex_tree_leaf_iterator__<impl_T_, Policy, false>;
+        using const_leaf_iterator = detail__::flat_flex_tree_leaf_iterator__<impl_T_, Policy, true>;
+
+        using node_traits = detail__::flat_flex_tree_node_traits__<Policy>;
+
+        /**
+         * @name constructors and special member functions
+         * @{
+         */
+
+        flat_flex_tree(const allocator_type& allocator = allocator_type())
+            : impl_M_(allocator)
+        { }
+
+        /**
+         * @brief
+         * initializes the tree using a recursively constructed initializer-list, like flex_tree.
+         * @param ilist the initializer-list containing the values and node-hierarchy.
+         */
+        flat_flex_tree(std::initializer_list<initializer_type> ilist, const allocator_type& allocator = allocator_type())
+            : impl_M_(allocator)
+        { this->impl_M_.build_M_(ilist, impl_T_::npos_M_, 1ull); }
+
+        /**
+         * @brief initializer-list assignment.
+         */
+        flat_flex_tree&
+        operator=(std::initializer_list<initializer_type> ilist)
+        {
+            this->clear();
+            this->impl_M_.build_M_(ilist, impl_T_::npos_M_, 1ull);
+            return *this;
+        }
+
+        /**
+         * @brief
+         * flattens a flex_tree: copies it's values in pre-order and records the structure of every node.
+         * O(n), one walk over the nodes of `tree`.
+         */
+        template <typename OtherAllocator, typename OtherPolicy>
+        explicit flat_flex_tree(const flex_tree<Type, OtherAllocator, OtherPolicy>& tree, const allocator_type& allocator = allocator_type())
+            : impl_M_(allocator)
+        { this->from_flex_tree_M_(tree); }
+
+        flat_flex_tree(const flat_flex_tree&) = default;
+        flat_flex_tree(flat_flex_tree&&) noexcept = default;
+        flat_flex_tree& operator=(const flat_flex_tree&) = default;
+        flat_flex_tree& operator=(flat_flex_tree&&) noexcept = default;
+
+        friend void
+        swap(flat_flex_tree& a, flat_flex_tree& b) noexcept
+        {
+            using std::swap;
+            swap(a.impl_M_, b.impl_M_);
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name conversion
+         * @{
+         */
+
+        /**
+         * @brief rebuilds a node-based flex_tree with the same values and structure. O(n).
+         * @tparam OtherAllocator, OtherPolicy the configuration of the new tree.
+         */
+        template <typename OtherAllocator = Allocator, typename OtherPolicy = Policy>
+        flex_tree<Type, OtherAllocator, OtherPolicy>
+        to_flex_tree(const OtherAllocator& allocator = OtherAllocator()) const
+        {
+            flex_tree<Type, OtherAllocator, OtherPolicy> res__(allocator);
+            res__.from_pre_order_M_(this->size(),
+                [this](std::size_t i__) -> const value_type& { return this->impl_M_.values_M_[i__]; },
+                [this](std::size_t i__) { return this->impl_M_.depths_M_[i__]; });
+            return res__;
+        }
+
+        template <typename OtherAllocator, typename OtherPolicy>
+        explicit
+        operator flex_tree<Type, OtherAllocator, OtherPolicy>() const
+        { return this->to_flex_tree<OtherAllocator, OtherPolicy>(); }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name iteration
+         * @{
+         */
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the first node in `Traversal`-order, or end() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        begin() noexcept(Traversal == depth_first_pre_order || Traversal == depth_first_post_order)
+        { return iterator<Traversal>(&this->impl_M_, iterator<Traversal>::first_M_(this->impl_M_)); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-iterator to the first node in `Traversal`-order, or end() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        cbegin() const noexcept(Traversal == depth_first_pre_order || Traversal == depth_first_post_order)
+        { return const_iterator<Traversal>(&this->impl_M_, const_iterator<Traversal>::first_M_(this->impl_M_)); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the position behind the last node, the valueless root of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        end() noexcept
+        { return iterator<Traversal>(&this->impl_M_, this->impl_M_.size_M_()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-iterator to the position behind the last node, the valueless root of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        cend() const noexcept
+        { return const_iterator<Traversal>(&this->impl_M_, this->impl_M_.size_M_()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a reverse-iterator to the last node in `Traversal`-order, or rend() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        reverse_iterator<Traversal>
+        rbegin() noexcept
+        { return reverse_iterator<Traversal>(--this->end<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-reverse-iterator to the last node in `Traversal`-order, or crend() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        crbegin() const noexcept
+        { return const_reverse_iterator<Traversal>(--this->cend<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a reverse-iterator to the valueless root of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        reverse_iterator<Traversal>
+        rend() noexcept
+        { return reverse_iterator<Traversal>(this->end<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-reverse-iterator to the valueless root of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        crend() const noexcept
+        { return const_reverse_iterator<Traversal>(this->cend<Traversal>()); }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name modifiers. each one shifts the nodes behind the modified position, O(n).
+         * @{
+         */
+
+        /**
+         * @brief insert a new node as the first child of `where`.
+         * @param where an iterator to the new node's parent, end() for a new first top-level node.
+         * @return an iterator to the newly created node.
+         */
+        template <traversal Traversal = default_traversal, typename Value = value_type>
+            requires std::constructible_from<value_type, Value&&>
+        iterator<Traversal>
+        prepend(iterator<Traversal> where, Value&& value)
+        {
+            std::size_t parent__{where.index_M_};
+            std::size_t pos__{this->impl_M_.first_child_M_(parent__)};
+            this->impl_M_.insert_M_(pos__, this->parent_index_M_(parent__), this->impl_M_.depth_M_(parent__) + 1ull, std::forward<Value>(value));
+            return iterator<Traversal>(&this->impl_M_, pos__);
+        }
+
+        /**
+         * @brief insert a new node as the last child of `where`.
+         * @param where an iterator to the new node's parent, end() for a new last top-level node.
+         * @return an iterator to the newly created node.
+         */
+        template <traversal Traversal = default_traversal, typename Value = value_type>
+            requires std::constructible_from<value_type, Value&&>
+        iterator<Traversal>
+        append(iterator<Traversal> where, Value&& value)
+        {
+            std::size_t parent__{where.index_M_};
+            std::size_t pos__{this->impl_M_.subtree_end_M_(parent__)};
+            this->impl_M_.insert_M_(pos__, this->parent_index_M_(parent__), this->impl_M_.depth_M_(parent__) + 1ull, std::forward<Value>(value));
+            return iterator<Traversal>(&this->impl_M_, pos__);
+        }
+
+        /**
+         * @brief insert a new node as the next sibling of `where`.
+         * @return an iterator to the newly created node.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - `where` is an `end()`-iterator.
+         */
+        template <traversal Traversal = default_traversal, typename Value = value_type>
+            requires std::constructible_from<value_type, Value&&>
+        iterator<Traversal>
+        insert_after(iterator<Traversal> where, Value&& value)
+        {
+            this->check_not_root_M_(where.index_M_);
+            std::size_t pos__{this->impl_M_.subtree_end_M_(where.index_M_)};
+            this->impl_M_.insert_M_(pos__, this->impl_M_.parents_M_[where.index_M_], this->impl_M_.depths_M_[where.index_M_], std::forward<Value>(value));
+            return iterator<Traversal>(&this->impl_M_, pos__);
+        }
+
+        /**
+         * @brief insert a new node as the previous sibling of `where`.
+         * @return an iterator to the newly created node.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - `where` is an `end()`-iterator.
+         */
+        template <traversal Traversal = default_traversal, typename Value = value_type>
+            requires std::constructible_from<value_type, Value&&>
+        iterator<Traversal>
+        insert_before(iterator<Traversal> where, Value&& value)
+        {
+            this->check_not_root_M_(where.index_M_);
+            std::size_t pos__{where.index_M_};
+            this->impl_M_.insert_M_(pos__, this->impl_M_.parents_M_[pos__], this->impl_M_.depths_M_[pos__], std::forward<Value>(value));
+            return iterator<Traversal>(&this->impl_M_, pos__);
+        }
+
+        /**
+         * @brief erases the node `where` points to, including all of it's descendants.
+         * @return an iterator to the node that followed `where`'s subtree in `Traversal`-order.
+         * @note exceptions are thrown / the behaviour is undefined if:
+         * - `where` is an `end()`-iterator.
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        erase(iterator<Traversal> where)
+        {
+            this->check_not_root_M_(where.index_M_);
+            std::size_t first__{where.index_M_};
+            std::size_t last__{this->impl_M_.subtree_end_M_(first__)};
+            std::size_t next__{first__}; /* in pre-order, the subtree is followed by what ends up at it's position */
+            if constexpr (Traversal != depth_first_pre_order)
+            {
+                iterator<Traversal> iter__{std::next(where)};
+                while (iter__.index_M_ > first__ && iter__.index_M_ < last__) /* skip the descendants */
+                { ++iter__; }
+                next__ = iter__.index_M_ > first__ ? iter__.index_M_ - (last__ - first__) : iter__.index_M_;
+            }
+            this->impl_M_.erase_M_(first__);
+            return iterator<Traversal>(&this->impl_M_, next__);
+        }
+
+        /**
+         * @brief erases every node in the tree.
+         */
+        void
+        clear() noexcept
+        { this->impl_M_.clear_M_(); }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name container-information
+         * @{
+         */
+
+        /**
+         * @return the depth of the deepest node in the tree.
+         */
+        std::size_t
+        maximum_depth() const noexcept
+        {
+            return this->empty() ? 0ull :
+                *std::max_element(this->impl_M_.depths_M_.begin(), this->impl_M_.depths_M_.end());
+        }
+
+        /**
+         * @brief get the associated allocator object.
+         * @return instance of `allocator_type`
+         */
+        allocator_type
+        get_allocator() const noexcept
+        { return allocator_type(this->impl_M_.values_M_.get_allocator()); }
+
+        /**
+         * @return the total node-count of the tree.
+         */
+        std::size_t
+        size() const noexcept
+        { return this->impl_M_.size_M_(); }
+
+        /**
+         * @return true if the tree is empty.
+         */
+        bool
+        empty() const noexcept
+        { return !this->impl_M_.size_M_(); }
+
+        /**
+         * @}
+         */
+
+    protected:
+
+        /* the value of the parent-array for the children of i__ */
+        std::size_t
+        parent_index_M_(std::size_t i__) const noexcept
+        { return this->impl_M_.is_root_M_(i__) ? impl_T_::npos_M_ : i__; }
+
+        void
+        check_not_root_M_(std::size_t i__) const noexcept(!Policy::exceptions)
+        {
+            if constexpr (Policy::exceptions)
+            { if (this->impl_M_.is_root_M_(i__)) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!this->impl_M_.is_root_M_(i__)); }
+        }
+
+        /**
+         * walks the nodes of tree__ in pre-order and keeps the indices of the ancestors of the current node,
+         * so the subtree-size of an ancestor is known once the walk climbs back up from it's last descendant.
+         */
+        template <typename OtherAllocator, typename OtherPolicy>
+        void
+        from_flex_tree_M_(const flex_tree<Type, OtherAllocator, OtherPolicy>& tree__)
+        {
+            using c_base_ptr_T_ = const detail__::flex_tree_node_base__<OtherPolicy>*;
+            using c_node_ptr_T_ = const detail__::flex_tree_node__<Type, OtherPolicy>*;
+
+            c_base_ptr_T_ header__{&tree__.impl_M_.header_M_};
+            if (!header__->has_children_M_())
+            { return; }
+            this->impl_M_.reserve_M_(tree__.size());
+
+            std::vector<std::size_t> path__;
+            c_base_ptr_T_ iter__{header__->first_child_M_};
+            while (true)
+            {
+                std::size_t index__{this->impl_M_.size_M_()};
+                this->impl_M_.values_M_.push_back(static_cast<c_node_ptr_T_>(iter__)->value_M_);
+                this->impl_M_.subtree_sizes_M_.push_back(1ull);
+                this->impl_M_.depths_M_.push_back(path__.size() + 1ull);
+                this->impl_M_.parents_M_.push_back(path__.empty() ? impl_T_::npos_M_ : path__.back());
+
+                if (iter__->has_children_M_())
+                { path__.push_back(index__); iter__ = iter__->first_child_M_; continue; }
+                while (iter__->is_last_child_M_())
+                {
+                    iter__ = iter__->parent_M_;
+                    if (iter__ == header__) { return; }
+                    this->impl_M_.subtree_sizes_M_[path__.back()] = this->impl_M_.size_M_() - path__.back();
+                    path__.pop_back();
+                }
+                iter__ = iter__->next_M_;
+            }
+        }
+
+        impl_T_ impl_M_;
+    };
+
+    /**
+     * @brief 
+     * read-only snapshot of a flex_tree, returned by trl::freeze(). it owns a flat_flex_tree, but only hands out const-iterators,
+     * `node_traits` and the container-information, so nothing can modify the snapshot while it's served.
+     * @tparam Type, Allocator, Policy the template-arguments of the frozen flex_tree.
+     */
+    template <typename Type, typename Allocator = std::allocator<Type>, typename Policy = flex_tree_policy>
+    class frozen_flex_tree
+    {
+    public:
+
+        using flat_tree_type = flat_flex_tree<Type, Allocator, Policy>;
+
+        static constexpr traversal default_traversal = Policy::default_traversal;
+
+        using value_type = Type;
+        using allocator_type = Allocator;
+        using policy_type = Policy;
+
+        /* every iterator of a snapshot is a const-iterator */
+
+        template <traversal Traversal = default_traversal>
+        using iterator = typename flat_tree_type::template const_iterator<Traversal>;
+
+        template <traversal Traversal = default_traversal>
+        using const_iterator = typename flat_tree_type::template const_iterator<Traversal>;
+
+        template <traversal Traversal = default_traversal>
+        using reverse_iterator = typename flat_tree_type::template const_reverse_iterator<Traversal>;
 
+        template <traversal Traversal = default_traversal>
+        using const_reverse_iterator = typename flat_tree_type::template const_reverse_iterator<Traversal>;
+
+        using leaf_iterator = typename flat_tree_type::const_leaf_iterator;
+        using const_leaf_iterator = typename flat_tree_type::const_leaf_iterator;
+
+        using node_traits = typename flat_tree_type::node_traits;
+
+        /**
+         * @name constructors
+         * @{
+         */
+
+        /**
+         * @brief takes a snapshot of `tree` with it's allocator. O(n).
+         */
+        explicit frozen_flex_tree(const flex_tree<Type, Allocator, Policy>& tree)
+            : tree_M_(tree, tree.get_allocator())
+        { }
+
+        frozen_flex_tree(const frozen_flex_tree&) = default;
+        frozen_flex_tree(frozen_flex_tree&&) noexcept = default;
+        frozen_flex_tree& operator=(const frozen_flex_tree&) = default;
+        frozen_flex_tree& operator=(frozen_flex_tree&&) noexcept = default;
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief rebuilds a mutable flex_tree from the snapshot. O(n).
+         */
+        template <typename OtherAllocator = Allocator, typename OtherPolicy = Policy>
+        flex_tree<Type, OtherAllocator, OtherPolicy>
+        to_flex_tree(const OtherAllocator& allocator = OtherAllocator()) const
+        { return this->tree_M_.template to_flex_tree<OtherAllocator, OtherPolicy>(allocator); }
+
+        /**
+         * @return the snapshot as a const flat_flex_tree, e.g. for it's value-arrays.
+         */
+        const flat_tree_type&
+        flat() const noexcept
+        { return this->tree_M_; }
+
+        /**
+         * @name iterators. all of them are const.
+         * @{
+         */
+
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        begin() const noexcept(Traversal == depth_first_pre_order || Traversal == depth_first_post_order)
+        { return this->tree_M_.template cbegin<Traversal>(); }
+
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        cbegin() const noexcept(Traversal == depth_first_pre_order || Traversal == depth_first_post_order)
+        { return this->tree_M_.template cbegin<Traversal>(); }
+
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        end() const noexcept
+        { return this->tree_M_.template cend<Traversal>(); }
+
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        cend() const noexcept
+        { return this->tree_M_.template cend<Traversal>(); }
+
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        rbegin() const noexcept
+        { return this->tree_M_.template crbegin<Traversal>(); }
+
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        crbegin() const noexcept
+        { return this->tree_M_.template crbegin<Traversal>(); }
+
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        rend() const noexcept
+        { return this->tree_M_.template crend<Traversal>(); }
+
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        crend() const noexcept
+        { return this->tree_M_.template crend<Traversal>(); }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name container-information
+         * @{
+         */
+
+        std::size_t
+        maximum_depth() const noexcept
+        { return this->tree_M_.maximum_depth(); }
+
+        allocator_type
+        get_allocator() const noexcept
+        { return this->tree_M_.get_allocator(); }
+
+        std::size_t
+        size() const noexcept
+        { return this->tree_M_.size(); }
+
+        bool
+        empty() const noexcept
+        { return this->tree_M_.empty(); }
+
+        /**
+         * @}
+         */
+
+    protected:
+
+        flat_tree_type tree_M_;
     };
 
+    /**
+     * @brief
+     * takes a read-only, pointer-free snapshot of a flex_tree: it's values in pre-order and the structure-arrays next to them. O(n).
+     * the snapshot only provides const-iteration in every traversal-order, leaf-iteration through `node_traits` and `node_traits`-queries.
+     */
+    template <typename Type, typename Allocator, typename Policy>
+    frozen_flex_tree<Type, Allocator, Policy>
+    freeze(const flex_tree<Type, Allocator, Policy>& tree)
+    { return frozen_flex_tree<Type, Allocator, Policy>(tree); }
+
+    /**
+     * @brief rebuilds a mutable flex_tree from a snapshot taken with `trl::freeze()`, with the snapshot's allocator and policy. O(n).
+     */
+    template <typename Type, typename Allocator, typename Policy>
+    flex_tree<Type, Allocator, Policy>
+    thaw(const frozen_flex_tree<Type, Allocator, Policy>& snapshot)
+    { return snapshot.template to_flex_tree<Allocator, Policy>(snapshot.get_allocator()); }
+
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,26 +1,45 @@
+/********************************/
 #ifndef TRL_FLAT_N_ARY_TREE_HPP
 #define TRL_FLAT_N_ARY_TREE_HPP
-
+/********************************/
 /**
  * @file    flat_n_ary_tree.hpp
  * @date    25/08/2025
  * @author  Julian Benzel
  *
  * @brief
- * C++ STL-like implementation of an n-ary tree data-structure.
+ * C++ STL-like implementation of a complete n-ary tree data-structure, stored implicitly in a single array.
  *
  * @details
- * 
+ * trl::flat_n_ary_tree keeps it's values in breadth-first (level-) order in one array, like a binary heap:
+ * the children of the node at index i are at Size * i + 1 ... Size * i + Size and it's parent is at (i - 1) / Size.
+ * no links or structure-fields are stored at all, the shape of the tree follows from it's size: every layer is full,
+ * except for the deepest one, which is filled from the left. nodes are added and removed at the end of that order.
  *
+ * every depth-layer is a contiguous range of the array (see layer()), so per-layer loops e.g. for bottom-up aggregation
+ * run over plain arrays that the compiler can vectorise, and top-down descents touch one predictable index per level.
+ *
+ * it offers the same iterators and node_traits as trl::flex_tree, with the same traversal-orders, and takes the
+ * same policy (trl::flex_tree_policy) for it's exceptions and default traversal. the node-layout members of the policy
+ * have no effect. like trl::flex_tree, the tree has a valueless root (the end()-position), which has one child: the node at index 0.
  */
 /********************************/
 #include <concepts>
+#include <cstddef>
 #include <memory>
 #include <iterator>
 #include <initializer_list>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <vector>
+#include <span>
+#include <array>
+#include <algorithm>
+#include <bit>
 #include <cassert>
+
+#include "flex_tree.hpp"
 /********************************/
 
 namespace trl
@@ -28,16 +47,1300 @@ namespace trl
 
     namespace detail__
     {
+        /**
+         * @brief
+         * the value-array of a flat_n_ary_tree and the index-arithmetic on it.
+         * @details
+         * every index outside of this struct is a position in level-order, index size_M_() acts as the valueless root
+         * of the tree (the end()-position). where the value of an index is stored depends on Layout__:
+         * - level_order_layout:   at the same index.
+         * - van_emde_boas_layout: the full layers, the perfect tree on top, are stored in van-emde-boas order: it's upper half
+         *                         (in height) first, then every subtree hanging below it, each one recursively laid out the same way.
+         *                         the partially filled deepest layer follows in level-order, so appending and removing at the end
+         *                         of the level-order stays O(1), until a layer fills up or empties and the perfect tree is rearranged.
+         */
+        template <typename ValTp__, std::size_t Size__, typename Alloc__, flat_tree_layout Layout__>
+        struct flat_n_ary_tree_impl__
+        {
+            static_assert(Size__ > 0ull, "trl::flat_n_ary_tree: nodes need at least one child-slot");
+            static_assert(!std::is_same_v<ValTp__, bool>, "trl::flat_n_ary_tree: std::vector<bool> does not hold addressable values");
+
+            using value_type = ValTp__;
+            using value_alloc_T_ = typename std::allocator_traits<Alloc__>::template rebind_alloc<ValTp__>;
+
+            static constexpr std::size_t arity_M_{Size__};
+
+            /* widths of the layers and sizes of perfect trees of every height, saturated where they would overflow */
+            static constexpr std::size_t max_height_M_{64ull};
+            static constexpr std::array<std::size_t, max_height_M_ + 1ull> layer_widths_M_ = []()
+            {
+                std::array<std::size_t, max_height_M_ + 1ull> res__{};
+                res__[0] = 1ull;
+                for (std::size_t i__{1ull}; i__ <= max_height_M_; ++i__)
+                { res__[i__] = res__[i__ - 1ull] > static_cast<std::size_t>(-1) / Size__ ? static_cast<std::size_t>(-1) : res__[i__ - 1ull] * Size__; }
+                return res__;
+            }();
+            static constexpr std::array<std::size_t, max_height_M_ + 1ull> perfect_sizes_M_ = []()
+            {
+                std::array<std::size_t, max_height_M_ + 1ull> res__{};
+                for (std::size_t i__{1ull}; i__ <= max_height_M_; ++i__)
+                {
+                    res__[i__] = res__[i__ - 1ull] > static_cast<std::size_t>(-1) - layer_widths_M_[i__ - 1ull] ?
+                        static_cast<std::size_t>(-1) : res__[i__ - 1ull] + layer_widths_M_[i__ - 1ull];
+                }
+                return res__;
+            }();
+
+            /*
+             * a node of the perfect tree in van-emde-boas order is stored at base_M_ of it's layer, plus for every bottom-subtree
+             * it's nested in (outermost first) the index of that subtree times it's size. the index of that subtree is made up of
+             * the leading digits (in base Size__) of the node's offset in it's layer, all but the last below_M_ ones.
+             */
+            struct veb_step__
+            {
+                std::size_t below_M_;  /* layers from the root of the bottom-subtree down to the node */
+                std::size_t size_M_;   /* nodes in each bottom-subtree */
+            };
+
+            struct veb_layer__
+            {
+                std::size_t base_M_;
+                std::size_t step_count_M_;
+                std::array<veb_step__, 8ull> steps_M_;  /* log2(max_height_M_) + 1 nestings at most */
+            };
+
+            using veb_layer_alloc_T_ = typename std::allocator_traits<Alloc__>::template rebind_alloc<veb_layer__>;
+
+            std::vector<ValTp__, value_alloc_T_> values_M_;
+            /* one entry per layer of the perfect tree in van-emde-boas order, always empty for level_order_layout */
+            std::vector<veb_layer__, veb_layer_alloc_T_> veb_layers_M_;
+
+            explicit flat_n_ary_tree_impl__(const Alloc__& alloc__)
+                : values_M_(value_alloc_T_(alloc__))
+                , veb_layers_M_(veb_layer_alloc_T_(alloc__))
+            { }
+
+            /**
+             * @name storage-layout
+             * @{
+             */
+
+            /* with a power-of-two arity, divisions by layer-widths become shifts */
+            static constexpr bool pow2_arity_M_{std::has_single_bit(Size__)};
+            static constexpr std::size_t arity_shift_M_{static_cast<std::size_t>(std::countr_zero(Size__))};
+
+            /* 0-based depth of the level-order index i__, 0 for the top-level node */
+            static std::size_t
+            layer_of_M_(std::size_t i__) noexcept
+            {
+                if constexpr (pow2_arity_M_ && Size__ > 1ull)
+                { return (static_cast<std::size_t>(std::bit_width(i__ * (Size__ - 1ull) + 1ull)) - 1ull) / arity_shift_M_; }
+                else
+                {
+                    std::size_t res__{0ull};
+                    while (perfect_sizes_M_[res__ + 1ull] <= i__)
+                    { ++res__; }
+                    return res__;
+                }
+            }
+
+            /* where the value of the level-order index i__ is stored */
+            std::size_t
+            position_M_(std::size_t i__) const noexcept
+            {
+                if constexpr (Layout__ == level_order_layout)
+                { return i__; }
+                else
+                {
+                    if (i__ >= perfect_sizes_M_[this->veb_layers_M_.size()])
+                    { return i__; }
+                    std::size_t depth__{layer_of_M_(i__)};
+                    std::size_t offset__{i__ - perfect_sizes_M_[depth__]};
+                    const veb_layer__& layer__{this->veb_layers_M_[depth__]};
+                    std::size_t res__{layer__.base_M_};
+                    for (std::size_t k__{0ull}; k__ < layer__.step_count_M_; ++k__)
+                    {
+                        const veb_step__& step__{layer__.steps_M_[k__]};
+                        if constexpr (pow2_arity_M_)
+                        {
+                            res__ += (offset__ >> (step__.below_M_ * arity_shift_M_)) * step__.size_M_;
+                            offset__ &= layer_widths_M_[step__.below_M_] - 1ull;
+                        }
+                        else
+                        {
+                            res__ += (offset__ / layer_widths_M_[step__.below_M_]) * step__.size_M_;
+                            offset__ %= layer_widths_M_[step__.below_M_];
+                        }
+                    }
+                    return res__;
+                }
+            }
+
+            ValTp__&
+            value_M_(std::size_t i__) noexcept
+            { return this->values_M_[this->position_M_(i__)]; }
+
+            const ValTp__&
+            value_M_(std::size_t i__) const noexcept
+            { return this->values_M_[this->position_M_(i__)]; }
+
+            /* number of layers that are completely filled for count__ nodes */
+            static std::size_t
+            full_layers_for_M_(std::size_t count__) noexcept
+            {
+                std::size_t res__{0ull};
+                while (res__ < max_height_M_ && perfect_sizes_M_[res__ + 1ull] <= count__)
+                { ++res__; }
+                return res__;
+            }
+
+            /* the van-emde-boas order of a perfect tree with height__ layers */
+            static void
+            build_veb_layers_M_(std::size_t height__, std::vector<veb_layer__, veb_layer_alloc_T_>& layers__)
+            {
+                layers__.assign(height__, veb_layer__{});
+                for (std::size_t d__{0ull}; d__ < height__; ++d__)
+                {
+                    veb_layer__& layer__{layers__[d__]};
+                    std::size_t depth__{d__};
+                    std::size_t h__{height__};
+                    while (h__ > 1ull)
+                    {
+                        std::size_t top__{h__ / 2ull};
+                        if (depth__ < top__)
+                        { h__ = top__; continue; }
+                        depth__ -= top__;
+                        layer__.base_M_ += perfect_sizes_M_[top__];
+                        layer__.steps_M_[layer__.step_count_M_++] = veb_step__{ depth__, perfect_sizes_M_[h__ - top__] };
+                        h__ -= top__;
+                    }
+                }
+            }
+
+            /* stores the perfect tree of the top full_layers__ layers in van-emde-boas order instead of the current one. O(n). */
+            void
+            rearrange_M_(std::size_t full_layers__)
+            {
+                /* a van-emde-boas ordered path is still in level-order */
+                if constexpr (Layout__ == van_emde_boas_layout && Size__ > 1ull)
+                {
+                    if (full_layers__ == this->veb_layers_M_.size())
+                    { return; }
+                    std::size_t count__{std::min<std::size_t>(perfect_sizes_M_[std::max(full_layers__, this->veb_layers_M_.size())], this->size_M_())};
+                    std::vector<veb_layer__, veb_layer_alloc_T_> layers__(this->veb_layers_M_.get_allocator());
+                    build_veb_layers_M_(full_layers__, layers__);
+                    std::vector<ValTp__, value_alloc_T_> level_order__(this->values_M_.get_allocator());
+                    level_order__.reserve(count__);
+                    for (std::size_t i__{0ull}; i__ < count__; ++i__)
+                    { level_order__.push_back(std::move(this->value_M_(i__))); }
+                    this->veb_layers_M_.swap(layers__);
+                    for (std::size_t i__{0ull}; i__ < count__; ++i__)
+                    { this->value_M_(i__) = std::move(level_order__[i__]); }
+                }
+            }
+
+            /* to be called after the number of nodes changed */
+            void
+            update_layout_M_()
+            { this->rearrange_M_(full_layers_for_M_(this->size_M_())); }
+
+            /* to be called before the number of nodes shrinks to count__ */
+            void
+            prepare_shrink_M_(std::size_t count__)
+            { this->rearrange_M_(std::min(this->veb_layers_M_.size(), full_layers_for_M_(count__))); }
+
+            /**
+             * @}
+             */
+
+            /**
+             * @name structure-queries. i__ == size_M_() is the root.
+             * @{
+             */
+
+            std::size_t
+            size_M_() const noexcept
+            { return this->values_M_.size(); }
+
+            bool
+            is_root_M_(std::size_t i__) const noexcept
+            { return i__ == this->size_M_(); }
+
+            /* the node at index 0 is the only child of the root, the root is it's own parent */
+            std::size_t
+            parent_M_(std::size_t i__) const noexcept
+            { return (this->is_root_M_(i__) || !i__) ? this->size_M_() : (i__ - 1ull) / Size__; }
+
+            /* may be out of range, see has_children_M_() */
+            std::size_t
+            first_child_M_(std::size_t i__) const noexcept
+            { return this->is_root_M_(i__) ? 0ull : Size__ * i__ + 1ull; }
+
+            bool
+            has_children_M_(std::size_t i__) const noexcept
+            { return this->first_child_M_(i__) < this->size_M_(); }
+
+            /* expects child-nodes */
+            std::size_t
+            last_child_M_(std::size_t i__) const noexcept
+            { return this->is_root_M_(i__) ? 0ull : std::min<std::size_t>(Size__ * i__ + Size__, this->size_M_() - 1ull); }
+
+            std::size_t
+            child_count_M_(std::size_t i__) const noexcept
+            { return this->has_children_M_(i__) ? this->last_child_M_(i__) - this->first_child_M_(i__) + 1ull : 0ull; }
+
+            /* the last slot of a parent is a multiple of Size__ */
+            bool
+            has_next_M_(std::size_t i__) const noexcept
+            { return i__ && i__ % Size__ && i__ + 1ull < this->size_M_(); }
+
+            bool
+            is_first_child_M_(std::size_t i__) const noexcept
+            { return this->is_root_M_(i__) || !i__ || (i__ - 1ull) % Size__ == 0ull; }
+
+            /* the slot of i__ in it's parent, 0 for the node at index 0 */
+            std::size_t
+            slot_M_(std::size_t i__) const noexcept
+            { return i__ ? (i__ - 1ull) % Size__ : 0ull; }
+
+            std::size_t
+            depth_M_(std::size_t i__) const noexcept
+            {
+                if (this->is_root_M_(i__))
+                { return 0ull; }
+                std::size_t depth__{1ull};
+                for (; i__; i__ = (i__ - 1ull) / Size__)
+                { ++depth__; }
+                return depth__;
+            }
+
+            /**
+             * @}
+             */
+
+            /**
+             * @name traversal-steps, shared by the iterators and the tree. all of them are cyclic over the root.
+             * @{
+             */
+
+            std::size_t
+            leftmost_M_(std::size_t i__) const noexcept
+            {
+                while (this->has_children_M_(i__))
+                { i__ = this->first_child_M_(i__); }
+                return i__;
+            }
+
+            std::size_t
+            rightmost_M_(std::size_t i__) const noexcept
+            {
+                while (this->has_children_M_(i__))
+                { i__ = this->last_child_M_(i__); }
+                return i__;
+            }
+
+            std::size_t
+            pre_order_next_M_(std::size_t i__) const noexcept
+            {
+                if (this->has_children_M_(i__))
+                { return this->first_child_M_(i__); }
+                while (!this->is_root_M_(i__))
+                {
+                    if (this->has_next_M_(i__))
+                    { return i__ + 1ull; }
+                    i__ = this->parent_M_(i__);
+                }
+                return i__;
+            }
+
+            std::size_t
+            pre_order_prev_M_(std::size_t i__) const noexcept
+            {
+                if (this->is_root_M_(i__))
+                { return this->rightmost_M_(i__); }
+                if (!this->is_first_child_M_(i__))
+                { return this->rightmost_M_(i__ - 1ull); }
+                return this->parent_M_(i__);
+            }
+
+            std::size_t
+            post_order_next_M_(std::size_t i__) const noexcept
+            {
+                if (this->is_root_M_(i__))
+                { return this->leftmost_M_(i__); }
+                if (this->has_next_M_(i__))
+                { return this->leftmost_M_(i__ + 1ull); }
+                return this->parent_M_(i__);
+            }
+
+            std::size_t
+            post_order_prev_M_(std::size_t i__) const noexcept
+            {
+                if (this->has_children_M_(i__))
+                { return this->last_child_M_(i__); }
+                while (!this->is_root_M_(i__))
+                {
+                    if (!this->is_first_child_M_(i__))
+                    { return i__ - 1ull; }
+                    i__ = this->parent_M_(i__);
+                }
+                return i__;
+            }
+
+            /**
+             * @}
+             */
+        };
+
+        template <typename Impl__, typename Policy__, bool Const__>
+        struct flat_n_ary_tree_iterator_base__
+        {
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = typename std::conditional<Const__, const typename Impl__::value_type, typename Impl__::value_type>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = value_type*;
+            using reference = value_type&;
+
+            using self_T_ = flat_n_ary_tree_iterator_base__;
+            using policy_T_ = Policy__;
+            using impl_T_ = Impl__;
+            using impl_ptr_T_ = typename std::conditional<Const__, const Impl__*, Impl__*>::type;
+
+            impl_ptr_T_ impl_M_{nullptr};
+            std::size_t index_M_{0ull};
+
+            flat_n_ary_tree_iterator_base__() = default;
+
+            flat_n_ary_tree_iterator_base__(impl_ptr_T_ impl__, std::size_t index__) noexcept
+                : impl_M_(impl__)
+                , index_M_(index__)
+            { }
+
+            /**
+             * @name node-value accessors.
+             * @{
+             */
+
+            [[nodiscard]]
+            reference
+            operator*() const noexcept(!Policy__::iterator_exceptions)
+            {
+                if constexpr (Policy__::iterator_exceptions)
+                { if (this->impl_M_->is_root_M_(this->index_M_)) { throw std::logic_error("cannot dereference end()-iterator"); } }
+                else
+                { assert(!this->impl_M_->is_root_M_(this->index_M_)); /* out of bounds of the value-array. check only in debug. */ }
+                return this->impl_M_->value_M_(this->index_M_);
+            }
+
+            [[nodiscard]]
+            pointer
+            operator->() const noexcept(!Policy__::iterator_exceptions)
+            { return std::addressof(**this); }
+
+            /**
+             * @}
+             */
+
+            /**
+             * @name equality-operators. all iterators are comparable via the node they point to.
+             * @{
+             */
+
+            friend bool
+            operator==(const self_T_& a, const self_T_& b)
+            { return a.index_M_ == b.index_M_ && a.impl_M_ == b.impl_M_; }
+
+            friend bool /* can be omitted as of C++20 */
+            operator!=(const self_T_& a, const self_T_& b)
+            { return !(a == b); }
+
+            /**
+             * @}
+             */
+        };
+
+        /**
+         * @brief an iterator to a flat_n_ary_tree.
+         * @tparam Trav__ the traversal-algorithm used by the iterator.
+         */
+        template <traversal Trav__, typename Impl__, typename Policy__, bool Const__>
+        struct flat_n_ary_tree_iterator__; /* primary template. not to be instantiated. */
+
+        /**
+         * @brief partial-specialization for the depth-first traversals.
+         */
+        template <traversal Trav__, typename Impl__, typename Policy__, bool Const__>
+            requires (Trav__ == depth_first_pre_order || Trav__ == depth_first_post_order)
+        struct flat_n_ary_tree_iterator__<Trav__, Impl__, Policy__, Const__>
+            : public flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>
+        {
+            using self_T_ = flat_n_ary_tree_iterator__<Trav__, Impl__, Policy__, Const__>;
+            using base_T_ = flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>;
+            using base_T_::base_T_; /* use constructors of base-class */
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            flat_n_ary_tree_iterator__(const flat_n_ary_tree_iterator_base__<Impl__, Policy__, false>& other) noexcept
+                requires Const__
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            flat_n_ary_tree_iterator__(const flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>& other) noexcept
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            self_T_&
+            operator++() noexcept
+            {
+                if constexpr (Trav__ == depth_first_pre_order)
+                { this->index_M_ = this->impl_M_->pre_order_next_M_(this->index_M_); }
+                else
+                { this->index_M_ = this->impl_M_->post_order_next_M_(this->index_M_); }
+                return *this;
+            }
+
+            self_T_&
+            operator--() noexcept
+            {
+                if constexpr (Trav__ == depth_first_pre_order)
+                { this->index_M_ = this->impl_M_->pre_order_prev_M_(this->index_M_); }
+                else
+                { this->index_M_ = this->impl_M_->post_order_prev_M_(this->index_M_); }
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; --(*this); return old; }
+        };
+
+        /**
+         * @brief
+         * partial-specialization for breadth-first traversal.
+         * @details
+         * visits the nodes in the same alternating order as flex_tree's breadth-first iterators. a depth-layer
+         * is a contiguous range of the array, so a step is an increment or decrement within the current layer,
+         * or a jump to the next layer, which starts right behind it and is Size times as wide.
+         */
+        template <traversal Trav__, typename Impl__, typename Policy__, bool Const__>
+            requires (Trav__ == breadth_first_in_order || Trav__ == breadth_first_reverse_order)
+        struct flat_n_ary_tree_iterator__<Trav__, Impl__, Policy__, Const__>
+            : public flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>
+        {
+            using self_T_ = flat_n_ary_tree_iterator__<Trav__, Impl__, Policy__, Const__>;
+            using base_T_ = flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>;
+            using impl_ptr_T_ = typename base_T_::impl_ptr_T_;
+
+            static constexpr bool reversed_M_{Trav__ == breadth_first_reverse_order};
+            static constexpr std::size_t arity_M_{Impl__::arity_M_};
+
+            /* the current layer, as if it was full. meaningless at the root */
+            std::size_t layer_begin_M_{0ull};
+            std::size_t layer_width_M_{1ull};
+            std::size_t depth_M_{1ull};
+
+            flat_n_ary_tree_iterator__() = default;
+
+            flat_n_ary_tree_iterator__(impl_ptr_T_ impl__, std::size_t index__) noexcept
+                : base_T_(impl__, index__)
+            { this->locate_M_(); }
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            flat_n_ary_tree_iterator__(const flat_n_ary_tree_iterator_base__<Impl__, Policy__, false>& other) noexcept
+                requires Const__
+                : flat_n_ary_tree_iterator__(other.impl_M_, other.index_M_)
+            { }
+
+            flat_n_ary_tree_iterator__(const flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>& other) noexcept
+                : flat_n_ary_tree_iterator__(other.impl_M_, other.index_M_)
+            { }
+
+            self_T_&
+            operator++() noexcept
+            {
+                const Impl__& impl__{*this->impl_M_};
+                if (impl__.is_root_M_(this->index_M_))
+                {
+                    this->reset_M_();
+                    this->index_M_ = impl__.size_M_() ? 0ull : this->index_M_;
+                    return *this;
+                }
+                if (this->left_to_right_M_() ? this->index_M_ + 1ull < this->layer_end_M_() : this->index_M_ > this->layer_begin_M_)
+                {
+                    this->index_M_ = this->left_to_right_M_() ? this->index_M_ + 1ull : this->index_M_ - 1ull;
+                    return *this;
+                }
+                if (this->layer_begin_M_ + this->layer_width_M_ >= impl__.size_M_())
+                {
+                    this->reset_M_();
+                    this->index_M_ = impl__.size_M_();
+                    return *this;
+                }
+                this->layer_begin_M_ += this->layer_width_M_;
+                this->layer_width_M_ *= arity_M_;
+                ++this->depth_M_;
+                this->index_M_ = this->left_to_right_M_() ? this->layer_begin_M_ : this->layer_end_M_() - 1ull;
+                return *this;
+            }
+
+            self_T_&
+            operator--() noexcept
+            {
+                const Impl__& impl__{*this->impl_M_};
+                if (impl__.is_root_M_(this->index_M_))
+                {
+                    if (!impl__.size_M_())
+                    { return *this; }
+                    this->index_M_ = impl__.size_M_() - 1ull;
+                    this->locate_M_();
+                    this->index_M_ = this->left_to_right_M_() ? this->layer_end_M_() - 1ull : this->layer_begin_M_;
+                    return *this;
+                }
+                if (this->left_to_right_M_() ? this->index_M_ > this->layer_begin_M_ : this->index_M_ + 1ull < this->layer_end_M_())
+                {
+                    this->index_M_ = this->left_to_right_M_() ? this->index_M_ - 1ull : this->index_M_ + 1ull;
+                    return *this;
+                }
+                if (this->depth_M_ == 1ull)
+                {
+                    this->index_M_ = impl__.size_M_();
+                    return *this;
+                }
+                this->layer_width_M_ /= arity_M_;
+                this->layer_begin_M_ -= this->layer_width_M_;
+                --this->depth_M_;
+                this->index_M_ = this->left_to_right_M_() ? this->layer_end_M_() - 1ull : this->layer_begin_M_;
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; --(*this); return old; }
+
+        private:
+
+            bool
+            left_to_right_M_() const noexcept
+            { return static_cast<bool>(this->depth_M_ % 2ull) != reversed_M_; }
+
+            /* the deepest layer may not be full */
+            std::size_t
+            layer_end_M_() const noexcept
+            { return std::min(this->layer_begin_M_ + this->layer_width_M_, this->impl_M_->size_M_()); }
+
+            void
+            reset_M_() noexcept
+            {
+                this->layer_begin_M_ = 0ull;
+                this->layer_width_M_ = 1ull;
+                this->depth_M_ = 1ull;
+            }
+
+            /* finds the layer of index_M_, O(depth) */
+            void
+            locate_M_() noexcept
+            {
+                this->reset_M_();
+                if (!this->impl_M_ || this->impl_M_->is_root_M_(this->index_M_))
+                { return; }
+                while (this->index_M_ >= this->layer_begin_M_ + this->layer_width_M_)
+                {
+                    this->layer_begin_M_ += this->layer_width_M_;
+                    this->layer_width_M_ *= arity_M_;
+                    ++this->depth_M_;
+                }
+            }
+        };
+
+        /**
+         * @details
+         * reverse-iterator adaptor for flat_n_ary_tree::iterator. like flex_tree's, it points at the node it dereferences,
+         * instead of one behind it like std::reverse_iterator.
+         */
+        template <typename Iter__>
+        struct flat_n_ary_tree_reverse_iterator__
+        {
+            using base_type = Iter__;
+            using iterator_category = typename base_type::iterator_category;
+            using value_type = typename base_type::value_type;
+            using difference_type = typename base_type::difference_type;
+            using pointer = typename base_type::pointer;
+            using reference = typename base_type::reference;
+
+            using self_T_ = flat_n_ary_tree_reverse_iterator__;
+            using self_ref_T_ = self_T_&;
+            using c_self_ref_T_ = const self_T_&;
+
+            base_type instance_M_;
+
+            flat_n_ary_tree_reverse_iterator__() = default;
+
+            flat_n_ary_tree_reverse_iterator__(const base_type& iter) noexcept
+                : instance_M_(iter)
+            { }
+
+            /* const-promotion, the same way the underlying iterators are promoted */
+            template <typename OtherIter__>
+                requires (!std::is_same_v<OtherIter__, Iter__>) && std::constructible_from<Iter__, const OtherIter__&>
+            flat_n_ary_tree_reverse_iterator__(const flat_n_ary_tree_reverse_iterator__<OtherIter__>& other) noexcept
+                : instance_M_(other.instance_M_)
+            { }
+
+            base_type&
+            base()
+            { return this->instance_M_; }
 
+            const base_type&
+            base() const
+            { return this->instance_M_; }
+
+            self_ref_T_
+            operator++() noexcept
+            { --this->instance_M_; return *this; }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; --this->instance_M_; return old; }
+
+            self_ref_T_
+            operator--() noexcept
+            { ++this->instance_M_; return *this; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; ++this->instance_M_; return old; }
+
+            [[nodiscard]]
+            reference
+            operator*() const noexcept(noexcept(*std::declval<const base_type&>()))
+            { return *this->instance_M_; }
+
+            [[nodiscard]]
+            pointer
+            operator->() const noexcept(noexcept(*std::declval<const base_type&>()))
+            { return std::addressof(*this->instance_M_); }
+
+            friend bool
+            operator==(c_self_ref_T_ a, c_self_ref_T_ b)
+            { return a.instance_M_ == b.instance_M_; }
+
+            friend bool
+            operator!=(c_self_ref_T_ a, c_self_ref_T_ b)
+            { return a.instance_M_ != b.instance_M_; }
+        };
+
+        /**
+         * @brief
+         * iterates over the child-nodes of a node, like flex_tree's leaf_iterator.
+         * to be used with `trl::flat_n_ary_tree<>::node_traits::lbegin()`/`lend()`.
+         */
+        template <typename Impl__, typename Policy__, bool Const__>
+        struct flat_n_ary_tree_leaf_iterator__
+            : public flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>
+        {
+            using self_T_ = flat_n_ary_tree_leaf_iterator__;
+            using base_T_ = flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>;
+            using base_T_::base_T_; /* use constructors of base-class */
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            flat_n_ary_tree_leaf_iterator__(const flat_n_ary_tree_iterator_base__<Impl__, Policy__, false>& other) noexcept
+                requires Const__
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            flat_n_ary_tree_leaf_iterator__(const flat_n_ary_tree_iterator_base__<Impl__, Policy__, Const__>& other) noexcept
+                : base_T_(other.impl_M_, other.index_M_)
+            { }
+
+            self_T_&
+            operator++() noexcept
+            {
+                this->index_M_ = this->impl_M_->has_next_M_(this->index_M_) ?
+                    this->index_M_ + 1ull : this->impl_M_->parent_M_(this->index_M_);
+                return *this;
+            }
+
+            self_T_&
+            operator--() noexcept
+            {
+                this->index_M_ = this->impl_M_->is_first_child_M_(this->index_M_) ?
+                    this->impl_M_->parent_M_(this->index_M_) : this->index_M_ - 1ull;
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; --(*this); return old; }
+        };
+
+        /**
+         * @brief
+         * provides (optionally exception-safe) information about a node's placement in a flat_n_ary_tree.
+         * every query is index-arithmetic, next/previous refer to siblings.
+         */
+        template <std::size_t Size__, typename Policy__>
+        struct flat_n_ary_tree_node_traits__
+        {
+
+            template <typename IteratorType>
+            static IteratorType
+            parent(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.impl_M_->is_root_M_(iter.index_M_)) { throw std::logic_error("root-node cannot have a parent-node"); } }
+                else
+                { assert(!iter.impl_M_->is_root_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->parent_M_(iter.index_M_));
+            }
+
+            /**
+             * @return an iterator to the child-node in slot `k` of iter, at index Size * i + 1 + k. O(1).
+             * the root has one child-slot, holding the node at index 0.
+             * @note exceptions are thrown / behaviour is undefined if:
+             * - `k` is not smaller than the arity of the tree.
+             * - the child-node does not exist (yet).
+             */
+            template <typename IteratorType>
+            static IteratorType
+            child(IteratorType iter, std::size_t k) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                {
+                    if (k >= Size__) { throw std::out_of_range("child-slot out of range"); }
+                    if (!has_child(iter, k)) { throw std::logic_error("node does not have a child-node in this slot"); }
+                }
+                else
+                { assert(has_child(iter, k)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->first_child_M_(iter.index_M_) + k);
+            }
+
+            /* false for missing child-nodes and slots out of range */
+            template <typename IteratorType>
+            static bool
+            has_child(IteratorType iter, std::size_t k) noexcept
+            {
+                if (iter.impl_M_->is_root_M_(iter.index_M_))
+                { return !k && iter.impl_M_->size_M_(); }
+                return k < Size__ && iter.impl_M_->first_child_M_(iter.index_M_) + k < iter.impl_M_->size_M_();
+            }
+
+            /* the index of iter in the child-slots of it's parent */
+            template <typename IteratorType>
+            static std::size_t
+            slot(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.impl_M_->is_root_M_(iter.index_M_)) { throw std::logic_error("root-node cannot be a child-node"); } }
+                else
+                { assert(!iter.impl_M_->is_root_M_(iter.index_M_)); }
+                return iter.impl_M_->slot_M_(iter.index_M_);
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            next(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (!iter.impl_M_->has_next_M_(iter.index_M_)) { throw std::logic_error("node does not have a next node"); } }
+                else
+                { assert(iter.impl_M_->has_next_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.index_M_ + 1ull);
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            previous(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.impl_M_->is_first_child_M_(iter.index_M_)) { throw std::logic_error("node does not have a previous node"); } }
+                else
+                { assert(!iter.impl_M_->is_first_child_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.index_M_ - 1ull);
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            first_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (!iter.impl_M_->has_children_M_(iter.index_M_)) { throw std::logic_error("node does not have any child-nodes"); } }
+                else
+                { assert(iter.impl_M_->has_children_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->first_child_M_(iter.index_M_));
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            last_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (!iter.impl_M_->has_children_M_(iter.index_M_)) { throw std::logic_error("node does not have any child-nodes"); } }
+                else
+                { assert(iter.impl_M_->has_children_M_(iter.index_M_)); }
+                return IteratorType(iter.impl_M_, iter.impl_M_->last_child_M_(iter.index_M_));
+            }
+
+            template <typename IteratorType>
+            static std::size_t
+            depth(IteratorType iter) noexcept
+            { return iter.impl_M_->depth_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static std::size_t
+            child_count(IteratorType iter) noexcept
+            { return iter.impl_M_->child_count_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            is_root(IteratorType iter) noexcept
+            { return iter.impl_M_->is_root_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            is_first_child(IteratorType iter) noexcept
+            { return iter.impl_M_->is_first_child_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            is_last_child(IteratorType iter) noexcept
+            { return !iter.impl_M_->has_next_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            has_next(IteratorType iter) noexcept
+            { return iter.impl_M_->has_next_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            has_previous(IteratorType iter) noexcept
+            { return !iter.impl_M_->is_first_child_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            has_children(IteratorType iter) noexcept
+            { return iter.impl_M_->has_children_M_(iter.index_M_); }
+
+            template <typename IteratorType>
+            static bool
+            is_only_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.impl_M_->is_root_M_(iter.index_M_)) { throw std::logic_error("root-node cannot be a child-node"); } }
+                else
+                { assert(!iter.impl_M_->is_root_M_(iter.index_M_)); }
+                return iter.impl_M_->is_first_child_M_(iter.index_M_) && !iter.impl_M_->has_next_M_(iter.index_M_);
+            }
+
+            template <typename IterTp__>
+            using leaf_iter_T_ = flat_n_ary_tree_leaf_iterator__<typename IterTp__::impl_T_, typename IterTp__::policy_T_, std::is_const_v<typename IterTp__::value_type>>;
+
+            template <typename IteratorType>
+            static leaf_iter_T_<IteratorType>
+            lbegin(IteratorType iter) noexcept(!Policy__::exceptions)
+            { return leaf_iter_T_<IteratorType>(iter.impl_M_, first_child(iter).index_M_); }
+
+            template <typename IteratorType>
+            static leaf_iter_T_<IteratorType>
+            lend(IteratorType iter) noexcept
+            { return leaf_iter_T_<IteratorType>(iter.impl_M_, iter.index_M_); }
+
+        };
     }
 
-    template <typename Type, std::size_t Size, 
-            typename Allocator = std::allocator<Type>>
+    /**
+     * @brief C++ STL-like implementation of a complete n-ary tree-data-structure, stored implicitly in level-order.
+     * @tparam Type the type that every node should contain.
+     * @tparam Size the number of child-slots of every node.
+     * @tparam Allocator an allocator type.
+     * @tparam Policy compile-time configuration of the tree, see trl::flex_tree_policy. only exceptions, iterator_exceptions
+     *         and default_traversal apply.
+     */
+    template <typename Type, std::size_t Size,
+            typename Allocator = std::allocator<Type>, typename Policy = flex_tree_policy>
     class flat_n_ary_tree
     {
+    protected:
+
+        using impl_T_ = detail__::flat_n_ary_tree_impl__<Type, Size, Allocator, Policy::flat_layout>;
+
+    public:
+
+        static constexpr traversal default_traversal = Policy::default_traversal;
+        static constexpr std::size_t arity = Size;
+
+        using value_type = Type;
+        using allocator_type = Allocator;
+        using policy_type = Policy;
+
+        template <traversal Traversal = default_traversal>
+        using iterator = detail__::flat_n_ary_tree_iterator__<Traversal, impl_T_, Policy, false>;
+
+        template <traversal Traversal = default_traversal>
+        using const_iterator = detail__::flat_n_ary_tree_iterator__<Traversal, impl_T_, Policy, true>;
+
+        template <traversal Traversal = default_traversal>
+        using reverse_iterator = detail__::flat_n_ary_tree_reverse_iterator__<iterator<Traversal>>;
+
+        template <traversal Traversal = default_traversal>
+        using const_reverse_iterator = detail__::flat_n_ary_tree_reverse_iterator__<const_iterator<Traversal>>;
+
+        using leaf_iterator = detail__::flat_n_ary_tree_leaf_iterator__<impl_T_, Policy, false>;
+        using const_leaf_iterator = detail__::flat_n_ary_tree_leaf_iterator__<impl_T_, Policy, true>;
+
+        using node_traits = detail__::flat_n_ary_tree_node_traits__<Size, Policy>;
+
+        /**
+         * @name constructors and special member functions
+         * @{
+         */
+
+        flat_n_ary_tree(const allocator_type& allocator = allocator_type())
+            : impl_M_(allocator)
+        { }
+
+        /**
+         * @brief constructs a complete tree of `count` copies of `value`.
+         */
+        flat_n_ary_tree(std::size_t count, const value_type& value, const allocator_type& allocator = allocator_type())
+            : impl_M_(allocator)
+        {
+            this->impl_M_.values_M_.assign(count, value);
+            this->impl_M_.update_layout_M_();
+        }
+
+        /**
+         * @brief constructs the tree from it's values in level-order. the shape follows from the number of values.
+         */
+        template <std::input_iterator InputIt>
+        flat_n_ary_tree(InputIt first, InputIt last, const allocator_type& allocator = allocator_type())
+            : impl_M_(allocator)
+        {
+            this->impl_M_.values_M_.assign(first, last);
+            this->impl_M_.update_layout_M_();
+        }
+
+        /**
+         * @brief constructs the tree from it's values in level-order, e.g. `{ root, child_0, child_1, grandchild_0, ... }`.
+         */
+        flat_n_ary_tree(std::initializer_list<value_type> ilist, const allocator_type& allocator = allocator_type())
+            : impl_M_(allocator)
+        {
+            this->impl_M_.values_M_.assign(ilist);
+            this->impl_M_.update_layout_M_();
+        }
+
+        /**
+         * @brief initializer-list assignment, in level-order.
+         */
+        flat_n_ary_tree&
+        operator=(std::initializer_list<value_type> ilist)
+        {
+            this->impl_M_.veb_layers_M_.clear();
+            this->impl_M_.values_M_.assign(ilist);
+            this->impl_M_.update_layout_M_();
+            return *this;
+        }
+
+        flat_n_ary_tree(const flat_n_ary_tree&) = default;
+        flat_n_ary_tree(flat_n_ary_tree&&) noexcept = default;
+        flat_n_ary_tree& operator=(const flat_n_ary_tree&) = default;
+        flat_n_ary_tree& operator=(flat_n_ary_tree&&) noexcept = default;
+
+        friend void
+        swap(flat_n_ary_tree& a, flat_n_ary_tree& b) noexcept
+        {
+            using std::swap;
+            swap(a.impl_M_, b.impl_M_);
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name iteration
+         * @{
+         */
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the first node in `Traversal`-order, or end() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        begin() noexcept
+        { return ++this->end<Traversal>(); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-iterator to the first node in `Traversal`-order, or end() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        cbegin() const noexcept
+        { return ++this->cend<Traversal>(); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the position behind the last node, the valueless root of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        end() noexcept
+        { return iterator<Traversal>(&this->impl_M_, this->impl_M_.size_M_()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-iterator to the position behind the last node, the valueless root of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        cend() const noexcept
+        { return const_iterator<Traversal>(&this->impl_M_, this->impl_M_.size_M_()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a reverse-iterator to the last node in `Traversal`-order, or rend() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        reverse_iterator<Traversal>
+        rbegin() noexcept
+        { return reverse_iterator<Traversal>(--this->end<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-reverse-iterator to the last node in `Traversal`-order, or crend() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        crbegin() const noexcept
+        { return const_reverse_iterator<Traversal>(--this->cend<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a reverse-iterator to the valueless root of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        reverse_iterator<Traversal>
+        rend() noexcept
+        { return reverse_iterator<Traversal>(this->end<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-reverse-iterator to the valueless root of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        crend() const noexcept
+        { return const_reverse_iterator<Traversal>(this->cend<Traversal>()); }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name array-access. the values in level-order, index i has it's children at Size * i + 1 ... Size * i + Size.
+         * with `flex_tree_policy::flat_layout == van_emde_boas_layout` data() is in storage-order instead and layer() is not available.
+         * @{
+         */
+
+        value_type*
+        data() noexcept
+        { return this->impl_M_.values_M_.data(); }
+
+        const value_type*
+        data() const noexcept
+        { return this->impl_M_.values_M_.data(); }
+
+        /**
+         * @brief the nodes of one depth-layer, left-to-right. only the deepest layer can be shorter than Size^(depth - 1).
+         * @param depth the depth of the layer, 1 for the top-level node like in `node_traits::depth()`.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - `depth` is 0 or deeper than `maximum_depth()`.
+         */
+        std::span<value_type>
+        layer(std::size_t depth) noexcept(!Policy::exceptions)
+            requires (Policy::flat_layout == level_order_layout)
+        {
+            auto [first__, last__] = this->layer_bounds_M_(depth);
+            return std::span<value_type>(this->data() + first__, last__ - first__);
+        }
+
+        std::span<const value_type>
+        layer(std::size_t depth) const noexcept(!Policy::exceptions)
+            requires (Policy::flat_layout == level_order_layout)
+        {
+            auto [first__, last__] = this->layer_bounds_M_(depth);
+            return std::span<const value_type>(this->data() + first__, last__ - first__);
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name modifiers. nodes can only be added and removed at the end of the level-order.
+         * @{
+         */
+
+        /**
+         * @brief constructs a new node in the next free slot, the leftmost free slot of the deepest layer.
+         * @return an iterator to the newly created node.
+         */
+        template <traversal Traversal = default_traversal, typename... Args>
+            requires std::constructible_from<value_type, Args&&...>
+        iterator<Traversal>
+        emplace_back(Args&&... args)
+        {
+            this->impl_M_.values_M_.emplace_back(std::forward<Args>(args)...);
+            this->impl_M_.update_layout_M_();
+            return iterator<Traversal>(&this->impl_M_, this->impl_M_.size_M_() - 1ull);
+        }
+
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        push_back(const value_type& value)
+        { return this->emplace_back<Traversal>(value); }
+
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        push_back(value_type&& value)
+        { return this->emplace_back<Traversal>(std::move(value)); }
+
+        /**
+         * @brief erases the last node in level-order.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - the tree is empty.
+         */
+        void
+        pop_back() noexcept(!Policy::exceptions && Policy::flat_layout == level_order_layout)
+        {
+            if constexpr (Policy::exceptions)
+            { if (this->empty()) { throw std::logic_error("cannot pop_back() from an empty tree"); } }
+            else
+            { assert(!this->empty()); }
+            this->impl_M_.prepare_shrink_M_(this->size() - 1ull);
+            this->impl_M_.values_M_.pop_back();
+        }
+
+        /**
+         * @brief grows (with default-constructed or copied values) or shrinks the tree to `count` nodes.
+         */
+        void
+        resize(std::size_t count)
+        {
+            this->impl_M_.prepare_shrink_M_(count);
+            this->impl_M_.values_M_.resize(count);
+            this->impl_M_.update_layout_M_();
+        }
+
+        void
+        resize(std::size_t count, const value_type& value)
+        {
+            this->impl_M_.prepare_shrink_M_(count);
+            this->impl_M_.values_M_.resize(count, value);
+            this->impl_M_.update_layout_M_();
+        }
+
+        void
+        reserve(std::size_t count)
+        { this->impl_M_.values_M_.reserve(count); }
+
+        /**
+         * @brief erases every node in the tree.
+         */
+        void
+        clear() noexcept
+        {
+            this->impl_M_.values_M_.clear();
+            this->impl_M_.veb_layers_M_.clear();
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name container-information
+         * @{
+         */
+
+        /**
+         * @return the depth of the deepest node in the tree, which is the last one.
+         */
+        std::size_t
+        maximum_depth() const noexcept
+        { return this->empty() ? 0ull : this->impl_M_.depth_M_(this->impl_M_.size_M_() - 1ull); }
+
+        /**
+         * @brief get the associated allocator object.
+         * @return instance of `allocator_type`
+         */
+        allocator_type
+        get_allocator() const noexcept
+        { return allocator_type(this->impl_M_.values_M_.get_allocator()); }
+
+        /**
+         * @return the total node-count of the tree.
+         */
+        std::size_t
+        size() const noexcept
+        { return this->impl_M_.size_M_(); }
+
+        /**
+         * @return true if the tree is empty.
+         */
+        bool
+        empty() const noexcept
+        { return !this->impl_M_.size_M_(); }
+
+        /**
+         * @}
+         */
+
+    protected:
+
+        /* [first, last) of the layer on depth__ */
+        std::pair<std::size_t, std::size_t>
+        layer_bounds_M_(std::size_t depth__) const noexcept(!Policy::exceptions)
+        {
+            if constexpr (Policy::exceptions)
+            { if (!depth__ || depth__ > this->maximum_depth()) { throw std::out_of_range("depth-layer out of range"); } }
+            else
+            { assert(depth__ && depth__ <= this->maximum_depth()); }
+            std::size_t first__{0ull};
+            std::size_t width__{1ull};
+            for (; depth__ > 1ull; --depth__)
+            { first__ += width__; width__ *= Size; }
+            return { first__, std::min(first__ + width__, this->size()) };
+        }
 
+        impl_T_ impl_M_;
     };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -15,17 +15,20 @@
  * - #define TRL_FLEX_TREE_FAST_DEPTH
  *   includes .depth as a member-field of every node in the tree. provides faster access to depth() value, but also additional bookkeeping.
  * - #define TRL_FLEX_TREE_NO_RECURSION
- *   some algorithms like node-copying or node-erasure use recursion to jump through every child-node. 
+ *   some algorithms like node-copying use recursion to jump through every child-node. 
  *   this flag will make them use the same depth-first iteration algorithm that flex_tree::iterator<depth_first_post_order> uses.
  * - #define TRL_FLEX_TREE_NOEXCEPT
  *   disables exception-safety for invalid operations on a tree.
  * - #define TRL_FLEX_TREE_ITER_NOEXCEPT
  *   disables exception-safety for iterators specifically. also disabled if TRL_FLEX_TREE_NOEXCEPT is defined.
+ * - #define TRL_FLEX_TREE_DEFAULT_TRAVERSAL
+ *   traversal used by iterator<> and member-functions that are not given one.
  * - #define NDEBUG (defined in release-builds)
  *   disables debug-asserts for invalid operations on a tree.
  * - #define TRL_FLEX_TREE_STL_REVERSE_ITER
  *   uses std::reverse_iterator for constructing flex_tree<>::reverse_iterator instead a custom implementation.
  *   for rationale/details see the documentation.
+ * the TRL_FLEX_TREE_* options only choose the members of trl::flex_tree_policy, see there.
  * 
  * naming-schemes:
  * - 'name__' describes an implementation namespace or type used internally by the implementation.
@@ -42,25 +45,18 @@
 /********************************/
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <iterator>
 #include <initializer_list>
 #include <type_traits>
 #include <stdexcept>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <random>
 #include <cassert>
 /********************************/
-#ifndef TRL_FLEX_TREE_NOEXCEPT
-    #define TRL_NOEXCEPT
-#else
-    #define TRL_NOEXCEPT noexcept
-#endif
-/********************************/
-#if !defined(TRL_FLEX_TREE_ITER_NOEXCEPT) && !defined (TRL_FLEX_TREE_NOEXCEPT)
-    #define TRL_ITER_NOEXCEPT
-#else
-    #define TRL_ITER_NOEXCEPT noexcept
-#endif
-/********************************/
 #ifndef TRL_FLEX_TREE_DEFAULT_TRAVERSAL
     #define TRL_FLEX_TREE_DEFAULT_TRAVERSAL depth_first_pre_order
 #endif
@@ -72,20 +68,190 @@ namespace trl
     {
         depth_first_pre_order,
         // depth_first_in_order,
-        // depth_first_post_order,
+        depth_first_post_order,
 
         // depth_first_reverse_pre_order,
         // depth_first_reverse_in_order,
         // depth_first_reverse_post_order,
         
         breadth_first_in_order,
-        // breadth_first_reverse_order
+        breadth_first_reverse_order
+    };
+
+    /* order in which a trl::flat_n_ary_tree stores it's values, see trl::flex_tree_policy::flat_layout */
+    enum flat_tree_layout
+    {
+        level_order_layout,
+        van_emde_boas_layout
     };
 
     namespace detail__
     {
+        /*
+         * the default policy, templated on the values the compile-options give it's members. translation units that
+         * define the options differently get distinct policy-types (and so distinct flex_tree-types) instead of two definitions of one type.
+         */
+        template <bool DepthCount__, bool NoRecursion__, bool Exceptions__, bool IteratorExceptions__, 
+                  traversal DefaultTraversal__, bool StlReverseIterator__>
+        struct flex_tree_policy__
+        {
+            /*
+             * true:  next/prev connect all nodes on a depth-layer, also across parents (cousins).
+             *        breadth-first iterators just walk these links, but hooking the first child of a node
+             *        searches sideways for it's nearest cousins, which costs O(width of the layer).
+             * false: next/prev only connect siblings, so every hook/unhook costs O(1).
+             *        breadth-first iterators keep a queue of the current depth-layer instead and only iterate forward.
+             *        required if prev_link or last_child_link is false.
+             */
+            static constexpr bool layer_links{true};
+
+            /*
+             * node-layout: every node stores it's parent, first child and next node, the fields below are optional.
+             * without all of them a node only holds three pointers besides it's value.
+             * operations that would have to walk the whole tree without a field do not compile (e.g. operator-- of every iterator
+             * and reverse-iteration need prev_link and last_child_link), operations that only have to walk siblings fall back to that.
+             */
+
+            /* link to the previous node. without it insert_before(), erase() and splicing search the previous sibling in O(siblings). */
+            static constexpr bool prev_link{true};
+            /* link to the last child-node. without it append() and splicing behind the last child search it in O(children). */
+            static constexpr bool last_child_link{true};
+            /* number of child-nodes. without it node_traits::child_count() counts them in O(children). */
+            static constexpr bool child_count{true};
+            /*
+             * number of nodes in the subtree of the node, including itself. without it node_traits::subtree_size() counts them
+             * in O(subtree). with it every insertion, erasure, splice and concatenation updates the ancestors in O(depth).
+             */
+            static constexpr bool subtree_size{false};
+            /*
+             * two labels per node that order the entries into and exits out of all subtrees, so whether a node is an ancestor
+             * of another is known in O(1) (node_traits::is_ancestor(), the checks of splice_*()). without it these walk up in O(depth).
+             * positive answers are still confirmed by walking up where exceptions are on, since labels of different trees may nest.
+             * new nodes are labelled between their neighbours, only where those run out of room the labels of a surrounding range
+             * are spread again (amortized O(log(n)) per node). splices and concatenations label every node they move.
+             */
+            static constexpr bool ancestor_index{false};
+            /* depth of the node. without it depth()-queries walk up to the header in O(depth). */
+            static constexpr bool depth_count{DepthCount__};
+
+            /* 
+             * copying, erasing and depth-updates walk the descendants of a node iteratively instead of recursively.
+             * recursion goes as deep as the tree, so very deep trees (e.g. long chains) need this.
+             */
+            static constexpr bool no_recursion{NoRecursion__};
+
+            /* 
+             * invalid operations on the tree throw. without it they are only checked by debug-asserts and are noexcept.
+             * iterator_exceptions does the same for dereferencing end()-iterators.
+             */
+            static constexpr bool exceptions{Exceptions__};
+            static constexpr bool iterator_exceptions{IteratorExceptions__};
+
+            /* traversal used by flex_tree::iterator<> and every member-function template that is not given one. */
+            static constexpr traversal default_traversal{DefaultTraversal__};
+
+            /*
+             * order of the values of a trl::flat_n_ary_tree, no effect on any other tree.
+             * level_order_layout:   breadth-first, every depth-layer is a contiguous range of the array.
+             * van_emde_boas_layout: the full depth-layers are stored in recursive blocks of half their height, so a root-to-leaf walk
+             *                       touches O(log_B(n)) cache-lines instead of one per layer. every access pays for computing
+             *                       the position (O(log(depth)) for power-of-two arities), which only pays off for trees larger than the caches.
+             */
+            static constexpr flat_tree_layout flat_layout{level_order_layout};
+
+            /*
+             * flex_tree::reverse_iterator is std::reverse_iterator over the tree's iterator instead of the custom adaptor,
+             * which dereferences *std::prev(iter) and so runs the traversal-algorithm on every dereference. see the documentation.
+             */
+            static constexpr bool stl_reverse_iterator{StlReverseIterator__};
+        };
+    }
+
+#ifdef TRL_FLEX_TREE_FAST_DEPTH
+    #define TRL_FLEX_TREE_DEPTH_COUNT__ true
+#else
+    #define TRL_FLEX_TREE_DEPTH_COUNT__ false
+#endif
+#ifdef TRL_FLEX_TREE_NO_RECURSION
+    #define TRL_FLEX_TREE_NO_RECURSION__ true
+#else
+    #define TRL_FLEX_TREE_NO_RECURSION__ false
+#endif
+#ifndef TRL_FLEX_TREE_NOEXCEPT
+    #define TRL_FLEX_TREE_EXCEPTIONS__ true
+#else
+    #define TRL_FLEX_TREE_EXCEPTIONS__ false
+#endif
+#if !defined(TRL_FLEX_TREE_ITER_NOEXCEPT) && !defined(TRL_FLEX_TREE_NOEXCEPT)
+    #define TRL_FLEX_TREE_ITERATOR_EXCEPTIONS__ true
+#else
+    #define TRL_FLEX_TREE_ITERATOR_EXCEPTIONS__ false
+#endif
+#ifdef TRL_FLEX_TREE_STL_REVERSE_ITER
+    #define TRL_FLEX_TREE_STL_REVERSE_ITERATOR__ true
+#else
+    #define TRL_FLEX_TREE_STL_REVERSE_ITERATOR__ false
+#endif
+    /**
+     * @brief
+     * compile-time configuration of a flex_tree, passed as it's third template-argument.
+     * @details
+     * derive from it and redeclare single members to change them:
+     * @code
+     * struct sibling_links : trl::flex_tree_policy
+     * { static constexpr bool layer_links{false}; };
+     *
+     * trl::flex_tree<int, std::allocator<int>, sibling_links> tree;
+     * @endcode
+     * the compile-options TRL_FLEX_TREE_FAST_DEPTH, _NO_RECURSION, _NOEXCEPT, _ITER_NOEXCEPT, _DEFAULT_TRAVERSAL and _STL_REVERSE_ITER
+     * only choose the members of this type, see detail__::flex_tree_policy__. translation units that define them differently
+     * get different flex_tree-types, which can not be passed between them. trees that need different settings in the same program
+     * should use their own policies. a policy that is shared between such translation units can not derive from this type,
+     * as it's base would differ between them, it has to declare every member itself instead.
+     */
+    using flex_tree_policy = detail__::flex_tree_policy__<
+        TRL_FLEX_TREE_DEPTH_COUNT__,
+        TRL_FLEX_TREE_NO_RECURSION__,
+        TRL_FLEX_TREE_EXCEPTIONS__,
+        TRL_FLEX_TREE_ITERATOR_EXCEPTIONS__,
+        TRL_FLEX_TREE_DEFAULT_TRAVERSAL,
+        TRL_FLEX_TREE_STL_REVERSE_ITERATOR__
+    >;
+#undef TRL_FLEX_TREE_DEPTH_COUNT__
+#undef TRL_FLEX_TREE_NO_RECURSION__
+#undef TRL_FLEX_TREE_EXCEPTIONS__
+#undef TRL_FLEX_TREE_ITERATOR_EXCEPTIONS__
+#undef TRL_FLEX_TREE_STL_REVERSE_ITERATOR__
+
+    namespace detail__
+    {
+        /**
+         * @brief
+         * stands in for a member-field that the node-layout of a trl::flex_tree_policy leaves out, occupies no memory.
+         * writing to it does nothing and reading from it does not compile, so only reads have to be guarded by the policy.
+         * @tparam Tag__ distinguishes the fields, as empty members of the same type would need distinct addresses.
+         */
+        template <int Tag__>
+        struct flex_tree_absent_field__
+        {
+            constexpr flex_tree_absent_field__() noexcept = default;
+
+            template <typename Any__>
+            constexpr flex_tree_absent_field__(Any__&&) noexcept { }
+
+            constexpr flex_tree_absent_field__& operator++() noexcept { return *this; }
+            constexpr flex_tree_absent_field__& operator--() noexcept { return *this; }
+        };
+
+        template <bool Present__, typename Type__, int Tag__>
+        using flex_tree_field__ = typename std::conditional<Present__, Type__, flex_tree_absent_field__<Tag__>>::type;
+
+        template <typename Policy__>
         struct flex_tree_node_base__
         {
+            static_assert(!Policy__::layer_links || (Policy__::prev_link && Policy__::last_child_link), 
+                "trl::flex_tree_policy: layer_links requires prev_link and last_child_link");
+
             using base_pointer_T_ = flex_tree_node_base__*;
             using c_base_pointer_T_ = const flex_tree_node_base__*;
 
@@ -99,19 +265,21 @@ namespace trl
              * less intuitive, but allows for some cleaner operations later on
              * (e.g. header->first_child should always be the .begin() node).
              *
-             * if nodes are stack-allocated (like the header-node in previous versions)
-             * it gets a bit complicated to swap two nodes.
+             * the header-node is embedded into the tree, so moving or swapping trees has to 
+             * re-point the parent-pointers of the top-level nodes (see flex_tree_header_node__).
              */
             base_pointer_T_ parent_M_{this};
             base_pointer_T_ first_child_M_{this};
-            base_pointer_T_ last_child_M_{this};
             base_pointer_T_ next_M_{this};
-            base_pointer_T_ prev_M_{this};
 
-            std::size_t child_count_M_{0ull};
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            std::size_t depth_count_M_{0ull};
-        #endif 
+            /* optional, see the node-layout of trl::flex_tree_policy */
+            [[no_unique_address]] flex_tree_field__<Policy__::last_child_link, base_pointer_T_, 0> last_child_M_{this};
+            [[no_unique_address]] flex_tree_field__<Policy__::prev_link, base_pointer_T_, 1> prev_M_{this};
+            [[no_unique_address]] flex_tree_field__<Policy__::child_count, std::size_t, 2> child_count_M_{0ull};
+            [[no_unique_address]] flex_tree_field__<Policy__::depth_count, std::size_t, 3> depth_count_M_{0ull};
+            [[no_unique_address]] flex_tree_field__<Policy__::subtree_size, std::size_t, 4> subtree_size_M_{1ull}; /* not kept for the header */
+            [[no_unique_address]] flex_tree_field__<Policy__::ancestor_index, std::uint64_t, 5> enter_label_M_{0ull};
+            [[no_unique_address]] flex_tree_field__<Policy__::ancestor_index, std::uint64_t, 6> exit_label_M_{~0ull}; /* the header keeps 0 and ~0 */
 
             /**
              * @}
@@ -138,6 +306,11 @@ namespace trl
             bool 
             is_child_of(c_base_pointer_T_ parent__) const
             {
+                if constexpr (Policy__::ancestor_index)
+                { /* labels of different trees may nest as well, so only a negative answer is final */
+                    if (!this->labels_within_M_(parent__))
+                    { return false; }
+                }
                 c_base_pointer_T_ iter__{this->parent_M_};
                 do
                 {
@@ -149,18 +322,41 @@ namespace trl
                 return false;
             } 
 
+            /* whether node__ is an ancestor of this node, expects both to be in the same tree. O(1) for policies with ancestor_index. */
+            bool
+            is_descendant_of_M_(c_base_pointer_T_ node__) const
+            {
+                if constexpr (Policy__::ancestor_index)
+                { return this->labels_within_M_(node__); }
+                else
+                {
+                    for (c_base_pointer_T_ iter__{this}; !iter__->is_root_M_(); )
+                    {
+                        iter__ = iter__->parent_M_;
+                        if (iter__ == node__)
+                        { return true; }
+                    }
+                    return false;
+                }
+            }
+
+            bool
+            labels_within_M_(c_base_pointer_T_ node__) const requires (Policy__::ancestor_index)
+            { return node__->enter_label_M_ < this->enter_label_M_ && this->exit_label_M_ < node__->exit_label_M_; }
+
             std::size_t 
             depth_M_() const
             {
-            #ifdef TRL_FLEX_TREE_FAST_DEPTH
-                return this->depth_count_M_;
-            #else
-                c_base_pointer_T_ iter__{this};
-                std::size_t res__{0ull};
-                while (!iter__->is_root_M_()) 
-                { iter__ = iter__->parent_M_; ++res__; }
-                return res__;
-            #endif
+                if constexpr (Policy__::depth_count)
+                { return this->depth_count_M_; }
+                else
+                {
+                    c_base_pointer_T_ iter__{this};
+                    std::size_t res__{0ull};
+                    while (!iter__->is_root_M_()) 
+                    { iter__ = iter__->parent_M_; ++res__; }
+                    return res__;
+                }
             }
 
             bool 
@@ -169,7 +365,12 @@ namespace trl
 
             bool 
             is_first_child_M_() const /* why not just 'this == this->parent_M_->first_child_M_' ? (would always be false for root) */
-            { return !this->has_prev_M_() || this->prev_M_->parent_M_ != this->parent_M_; }
+            { 
+                if constexpr (Policy__::prev_link)
+                { return !this->has_prev_M_() || this->prev_M_->parent_M_ != this->parent_M_; }
+                else
+                { return this->parent_M_->first_child_M_ == this || this->is_root_M_(); }
+            }
             
             bool 
             is_last_child_M_() const
@@ -180,7 +381,7 @@ namespace trl
             { return this->next_M_ != this;  }
 
             bool 
-            has_prev_M_() const
+            has_prev_M_() const requires (Policy__::prev_link)
             { return this->prev_M_ != this; }
 
             bool 
@@ -189,7 +390,281 @@ namespace trl
 
             bool 
             is_only_child_M_() const 
-            { return this->parent_M_->child_count_M_ == 1ull;}
+            { 
+                if constexpr (Policy__::child_count)
+                { return this->parent_M_->child_count_M_ == 1ull; }
+                else
+                { return this->parent_M_->first_child_M_ == this && this->is_last_child_M_(); }
+            }
+
+            /*
+             * reading optional member-fields. without the field, the siblings are walked instead.
+             */
+
+            template <typename BasePtr__>
+            static BasePtr__
+            last_child_of_M_(BasePtr__ node__)
+            {
+                if constexpr (Policy__::last_child_link)
+                { return node__->last_child_M_; }
+                else
+                {
+                    BasePtr__ iter__{node__->first_child_M_};
+                    while (iter__ != node__ && !iter__->is_last_child_M_())
+                    { iter__ = iter__->next_M_; }
+                    return iter__;
+                }
+            }
+
+            /* expects node__ not to be a first child */
+            template <typename BasePtr__>
+            static BasePtr__
+            prev_sibling_of_M_(BasePtr__ node__)
+            {
+                if constexpr (Policy__::prev_link)
+                { return node__->prev_M_; }
+                else
+                {
+                    BasePtr__ iter__{node__->parent_M_->first_child_M_};
+                    while (iter__->next_M_ != node__)
+                    { iter__ = iter__->next_M_; }
+                    return iter__;
+                }
+            }
+
+            template <typename BasePtr__>
+            static std::size_t
+            child_count_of_M_(BasePtr__ node__)
+            {
+                if constexpr (Policy__::child_count)
+                { return node__->child_count_M_; }
+                else
+                {
+                    std::size_t res__{0ull};
+                    if (!node__->has_children_M_()) 
+                    { return res__; }
+                    for (BasePtr__ iter__{node__->first_child_M_}; ; iter__ = iter__->next_M_)
+                    { ++res__; if (iter__->is_last_child_M_()) { break; } }
+                    return res__;
+                }
+            }
+
+            /* expects node__ not to be the header, which knows the size of the whole tree */
+            template <typename BasePtr__>
+            static std::size_t
+            subtree_size_of_M_(BasePtr__ node__)
+            {
+                if constexpr (Policy__::subtree_size)
+                { return node__->subtree_size_M_; }
+                else
+                {
+                    std::size_t res__{1ull};
+                    if (!node__->has_children_M_())
+                    { return res__; }
+                    BasePtr__ iter__{node__->first_child_M_};
+                    while (true)
+                    {
+                        ++res__;
+                        if (iter__->has_children_M_())
+                        { iter__ = iter__->first_child_M_; continue; }
+                        while (iter__->is_last_child_M_())
+                        {
+                            iter__ = iter__->parent_M_;
+                            if (iter__ == node__) { return res__; }
+                        }
+                        iter__ = iter__->next_M_;
+                    }
+                }
+            }
+
+            /* adds count__ nodes to the subtree-size of every ancestor below the header. only for policies with subtree_size. */
+            void
+            grow_ancestors_M_(std::size_t count__)
+            {
+                for (base_pointer_T_ iter__{this->parent_M_}; !iter__->is_root_M_(); iter__ = iter__->parent_M_)
+                { iter__->subtree_size_M_ += count__; }
+            }
+
+            /* removes count__ nodes from the subtree-size of every ancestor below the header. only for policies with subtree_size. */
+            void
+            shrink_ancestors_M_(std::size_t count__)
+            {
+                for (base_pointer_T_ iter__{this->parent_M_}; !iter__->is_root_M_(); iter__ = iter__->parent_M_)
+                { iter__->subtree_size_M_ -= count__; }
+            }
+
+            /*
+             * the node at position k__ of the pre- or post-order of the tree below header__, expects k__ < size.
+             * skips every subtree in front of it as a whole, so it only walks the previous siblings of every node on the path down,
+             * which are all nodes of the layer for a flat tree. only for policies with subtree_size.
+             */
+            template <bool PostOrder__, typename BasePtr__>
+            static BasePtr__
+            nth_node_M_(BasePtr__ header__, std::size_t k__)
+            {
+                BasePtr__ iter__{header__->first_child_M_};
+                while (true)
+                {
+                    std::size_t size__{iter__->subtree_size_M_};
+                    if (k__ >= size__)
+                    { k__ -= size__; iter__ = iter__->next_M_; continue; }
+                    if constexpr (PostOrder__)
+                    { if (k__ + 1ull == size__) { return iter__; } }
+                    else
+                    { if (!k__) { return iter__; } --k__; }
+                    iter__ = iter__->first_child_M_;
+                }
+            }
+
+            /* position of node__ in the pre- or post-order of it's tree, the inverse of nth_node_M_. expects node__ not to be the header. */
+            template <bool PostOrder__, typename BasePtr__>
+            static std::size_t
+            index_of_node_M_(BasePtr__ node__)
+            {
+                std::size_t res__{PostOrder__ ? node__->subtree_size_M_ - 1ull : 0ull};
+                for (BasePtr__ iter__{node__}; !iter__->is_root_M_(); iter__ = iter__->parent_M_)
+                {
+                    for (BasePtr__ sibling__{iter__->parent_M_->first_child_M_}; sibling__ != iter__; sibling__ = sibling__->next_M_)
+                    { res__ += sibling__->subtree_size_M_; }
+                    if constexpr (!PostOrder__)
+                    { if (!iter__->parent_M_->is_root_M_()) { ++res__; } } /* the parent comes first */
+                }
+                return res__;
+            }
+
+            /*
+             * ancestor-index: the entry into and the exit out of every subtree is an event of a depth-first walk,
+             * their labels increase in that order. a node is an ancestor of another if it's events enclose the other's.
+             * only for policies with ancestor_index.
+             */
+
+            struct label_event__
+            {
+                base_pointer_T_ node_M_;
+                bool            exit_M_;
+            };
+
+            static std::uint64_t&
+            label_of_M_(label_event__ event__)
+            { return event__.exit_M_ ? event__.node_M_->exit_label_M_ : event__.node_M_->enter_label_M_; }
+
+            /* expects event__ not to be the exit out of the header */
+            static void
+            next_event_M_(label_event__& event__)
+            {
+                if (!event__.exit_M_)
+                {
+                    if (event__.node_M_->has_children_M_())
+                    { event__.node_M_ = event__.node_M_->first_child_M_; }
+                    else
+                    { event__.exit_M_ = true; }
+                }
+                else if (!event__.node_M_->is_last_child_M_())
+                { event__ = label_event__{event__.node_M_->next_M_, false}; }
+                else
+                { event__.node_M_ = event__.node_M_->parent_M_; }
+            }
+
+            /* expects event__ not to be the entry into the header */
+            static void
+            prev_event_M_(label_event__& event__)
+            {
+                if (event__.exit_M_)
+                {
+                    if (event__.node_M_->has_children_M_())
+                    { event__.node_M_ = last_child_of_M_(event__.node_M_); }
+                    else
+                    { event__.exit_M_ = false; }
+                }
+                else if (!event__.node_M_->is_first_child_M_())
+                { event__ = label_event__{prev_sibling_of_M_(event__.node_M_), true}; }
+                else
+                { event__.node_M_ = event__.node_M_->parent_M_; }
+            }
+
+            /* gives count__ events from first__ on evenly spaced labels in [min__, max__], expects max__ - min__ >= count__ */
+            static void
+            spread_labels_M_(label_event__ first__, std::size_t count__, std::uint64_t min__, std::uint64_t max__)
+            {
+                std::uint64_t step__{(max__ - min__) / count__};
+                std::uint64_t label__{min__ + step__ / 2ull};
+                for (std::size_t i__{0ull}; i__ < count__; ++i__, label__ += step__)
+                {
+                    label_of_M_(first__) = label__;
+                    if (i__ + 1ull < count__)
+                    { next_event_M_(first__); }
+                }
+            }
+
+            /* labels all nodes__ nodes below the header */
+            void
+            index_tree_M_(std::size_t nodes__)
+            {
+                if (nodes__)
+                { spread_labels_M_(label_event__{this->first_child_M_, false}, 2ull * nodes__, 1ull, ~0ull - 1ull); }
+            }
+
+            /*
+             * labels the nodes__ nodes of the subtree of this node after it was hooked. if the neighbouring labels leave no room,
+             * the smallest aligned range of labels around them that is sparse enough gets spread again
+             * (a range of 2^i labels may hold up to (2 / 1.4)^i events, as in the order-maintenance structure of Bender et al.).
+             */
+            void
+            index_subtree_M_(std::size_t nodes__)
+            {
+                std::size_t count__{2ull * nodes__};
+                label_event__ first__{this, false};
+                label_event__ last__{this, true};
+                label_event__ before__{first__};
+                label_event__ after__{last__};
+                prev_event_M_(before__);
+                next_event_M_(after__);
+                std::uint64_t low__{label_of_M_(before__)};
+                std::uint64_t high__{label_of_M_(after__)};
+                if (high__ - low__ > count__ + 1ull)
+                { spread_labels_M_(first__, count__, low__ + 1ull, high__ - 1ull); return; }
+
+                double capacity__{1.0};
+                for (int bits__{1}; bits__ <= 64; ++bits__)
+                {
+                    capacity__ *= 2.0 / 1.4;
+                    std::uint64_t mask__{bits__ < 64 ? (1ull << bits__) - 1ull : ~0ull};
+                    std::uint64_t min__{low__ & ~mask__};
+                    std::uint64_t max__{min__ + mask__};
+                    /* take in the neighbours with labels in the range, never the header's */
+                    while (true)
+                    {
+                        label_event__ iter__{first__};
+                        prev_event_M_(iter__);
+                        if (iter__.node_M_->is_root_M_() || label_of_M_(iter__) < min__)
+                        { break; }
+                        first__ = iter__;
+                        ++count__;
+                    }
+                    while (true)
+                    {
+                        label_event__ iter__{last__};
+                        next_event_M_(iter__);
+                        if (iter__.node_M_->is_root_M_() || label_of_M_(iter__) > max__)
+                        { break; }
+                        last__ = iter__;
+                        ++count__;
+                    }
+                    min__ = std::max<std::uint64_t>(min__, 1ull);
+                    max__ = std::min<std::uint64_t>(max__, ~0ull - 1ull);
+                    if ((static_cast<double>(count__) <= capacity__ || bits__ == 64) && max__ - min__ >= count__)
+                    { spread_labels_M_(first__, count__, min__, max__); return; }
+                }
+            }
+
+            /* forgets all child-nodes, without touching them */
+            void
+            clear_children_M_()
+            {
+                this->first_child_M_ = this;
+                this->last_child_M_ = this;
+                this->child_count_M_ = 0ull;
+            }
 
             /*
              * hooking / unhooking - bookkeeping subroutines
@@ -200,9 +675,8 @@ namespace trl
             {
                 this->parent_M_ = parent__;
                 ++parent__->child_count_M_;
-            #ifdef TRL_FLEX_TREE_FAST_DEPTH
-                this->depth_count_M_ = parent__->depth_count_M_ + 1;
-            #endif
+                if constexpr (Policy__::depth_count)
+                { this->depth_count_M_ = parent__->depth_count_M_ + 1; }
             }
 
             void 
@@ -223,7 +697,8 @@ namespace trl
             update_new_only_child_M_(base_pointer_T_ parent__)
             {
                 update_new_child_M_(parent__);
-                parent__->first_child_M_ = parent__->last_child_M_ = this;
+                parent__->first_child_M_ = this;
+                parent__->last_child_M_ = this;
             }
 
 
@@ -254,10 +729,7 @@ namespace trl
 
             void 
             update_discard_only_child_M_()
-            {
-                this->parent_M_->first_child_M_ = this->parent_M_->last_child_M_ = this->parent_M_;
-                --this->parent_M_->child_count_M_;
-            }
+            { this->parent_M_->clear_children_M_(); }
 
             /*
              * hooking / unhooking - subroutines
@@ -267,7 +739,7 @@ namespace trl
             entangle_M_(base_pointer_T_ next__)
             {
                 this->next_M_ = next__;
-                next__->prev_M_ = this;
+                next__->prev_M_ = this;  /* does nothing without prev-links */
             }
 
             void 
@@ -315,8 +787,11 @@ namespace trl
             void
             hook_as_only_child_M_(base_pointer_T_ parent__)
             {
-                this->entangle_find_next_cousin_M_(parent__);
-                this->entangle_find_prev_cousin_M_(parent__);
+                if constexpr (Policy__::layer_links)
+                {
+                    this->entangle_find_next_cousin_M_(parent__);
+                    this->entangle_find_prev_cousin_M_(parent__);
+                }
                 this->update_new_only_child_M_(parent__); 
             }
 
@@ -325,8 +800,11 @@ namespace trl
             {
                 if (parent__->has_children_M_())
                 { 
-                    if (parent__->first_child_M_->has_prev_M_())
-                    { parent__->first_child_M_->prev_M_->entangle_M_(this); }
+                    if constexpr (Policy__::layer_links)
+                    {
+                        if (parent__->first_child_M_->has_prev_M_())
+                        { parent__->first_child_M_->prev_M_->entangle_M_(this); }
+                    }
                     this->entangle_M_(parent__->first_child_M_);
                     this->update_new_first_child_M_(parent__); 
                 }
@@ -338,21 +816,26 @@ namespace trl
             hook_as_last_child_M_(base_pointer_T_ parent__)
             {  
                 if (parent__->has_children_M_())
-                { 
-                    if (parent__->last_child_M_->has_next_M_())
-                    { this->entangle_M_(parent__->last_child_M_->next_M_); }
-                    parent__->last_child_M_->entangle_M_(this); 
-                    this->update_new_last_child_M_(parent__); 
-                }
+                { this->hook_behind_last_child_M_(last_child_of_M_(parent__)); }
                 else
                 { this->hook_as_only_child_M_(parent__); }
             }
 
+            /* last__ is the current last child of it's parent */
+            void 
+            hook_behind_last_child_M_(base_pointer_T_ last__)
+            {
+                if (last__->has_next_M_())
+                { this->entangle_M_(last__->next_M_); }
+                last__->entangle_M_(this); 
+                this->update_new_last_child_M_(last__->parent_M_); 
+            }
+
             void 
             hook_as_next_sibling_M_(base_pointer_T_ prev__)
             {
                 if (prev__->is_last_child_M_()) 
-                { this->hook_as_last_child_M_(prev__->parent_M_); }
+                { this->hook_behind_last_child_M_(prev__); }
                 else
                 {
                     this->insert_between_M_(prev__, prev__->next_M_);
@@ -367,7 +850,7 @@ namespace trl
                 { this->hook_as_first_child_M_(next__->parent_M_); }
                 else
                 {
-                    this->insert_between_M_(next__->prev_M_, next__);
+                    this->insert_between_M_(prev_sibling_of_M_(next__), next__);
                     this->update_new_child_M_(next__->parent_M_);
                 }
             }
@@ -403,14 +886,127 @@ namespace trl
             void 
             unhook_M_()
             {
-                if (this->is_only_child_M_()) // has no siblings/cousins
-                { this->unhook_as_only_child_M_(); }
-                else if (this->has_prev_M_() && this->has_next_M_()) // has both
-                { this->unhook_as_regular_child_M_(); }
-                else if (this->has_prev_M_()) // has only prev
-                { this->unhook_as_last_child_M_(); }
-                else if (this->has_next_M_()) // has only next
-                { this->unhook_as_first_child_M_(); }
+                if constexpr (!Policy__::prev_link)
+                { this->unhook_forward_M_(); }
+                else
+                {
+                    /* 
+                     * classify by siblings, not by neighbours: a first-child can still 
+                     * have a previous cousin on the same depth-layer and vice-versa.
+                     */
+                    if (this->is_only_child_M_())
+                    { this->unhook_as_only_child_M_(); }
+                    else if (this->is_first_child_M_())
+                    { this->unhook_as_first_child_M_(); }
+                    else if (this->is_last_child_M_())
+                    { this->unhook_as_last_child_M_(); }
+                    else
+                    { this->unhook_as_regular_child_M_(); }
+                    this->next_M_ = this;
+                    this->prev_M_ = this;
+                }
+            }
+
+            /* 
+             * unhooking without prev-links (and therefore without layer-links): the previous sibling, 
+             * whose next_M_ has to skip this node, is searched from the parent's first child.
+             */
+            void
+            unhook_forward_M_()
+            {
+                base_pointer_T_ parent__{this->parent_M_};
+                base_pointer_T_ next__{this->has_next_M_() ? this->next_M_ : nullptr};
+                base_pointer_T_ prev__{parent__->first_child_M_ == this ? nullptr : prev_sibling_of_M_(this)};
+                if (!prev__ && !next__)
+                { parent__->clear_children_M_(); }
+                else
+                {
+                    if (prev__) { prev__->next_M_ = next__ ? next__ : prev__; }
+                    else { parent__->first_child_M_ = next__; }
+                    if (!next__) { parent__->last_child_M_ = prev__; }
+                    --parent__->child_count_M_;
+                }
+                this->next_M_ = this;
+            }
+
+            /*
+             * descendant-layers subroutines.
+             * a subtree occupies a contiguous range on every depth-layer below it's root.
+             * when a node is moved or inserted together with it's descendants, these ranges
+             * have to be cut out of / woven into the surrounding depth-layers, otherwise
+             * the horizontal links would still point into the subtree's previous location.
+             * both walk the subtree's layers, so they cost O(nodes on the edges of the subtree)
+             * plus the cousin-search on every layer. without layer-links there is nothing to do.
+             */
+
+            /**
+             * @brief advances [first__, last__] from the range of one depth-layer to the range of the layer below.
+             * @return false if no node in [first__, last__] has child-nodes.
+             */
+            template <typename BasePtr__>
+            static bool
+            next_layer_M_(BasePtr__& first__, BasePtr__& last__)
+            {
+                BasePtr__ iter__{first__};
+                while (!iter__->has_children_M_())
+                {
+                    if (iter__ == last__) 
+                    { return false; }
+                    iter__ = iter__->next_M_;
+                }
+                first__ = iter__->first_child_M_;
+                iter__ = last__;
+                while (!iter__->has_children_M_())
+                { iter__ = iter__->prev_M_; }
+                last__ = iter__->last_child_M_;
+                return true;
+            }
+
+            /**
+             * @brief cuts the range [first__, last__] out of it's depth-layer and relinks the nodes around it.
+             */
+            static void
+            unhook_layer_range_M_(base_pointer_T_ first__, base_pointer_T_ last__)
+            {
+                if (first__->has_prev_M_() && last__->has_next_M_())
+                { first__->prev_M_->entangle_M_(last__->next_M_); }
+                else if (first__->has_prev_M_())
+                { first__->prev_M_->next_M_ = first__->prev_M_; }
+                else if (last__->has_next_M_())
+                { last__->next_M_->prev_M_ = last__->next_M_; }
+                first__->prev_M_ = first__;
+                last__->next_M_ = last__;
+            }
+
+            void
+            unhook_descendant_layers_M_()
+            {
+                if constexpr (Policy__::layer_links)
+                {
+                    base_pointer_T_ first__{this};
+                    base_pointer_T_ last__{this};
+                    while (next_layer_M_(first__, last__))
+                    { unhook_layer_range_M_(first__, last__); }
+                }
+            }
+
+            void
+            hook_descendant_layers_M_()
+            {
+                if constexpr (Policy__::layer_links)
+                {
+                    base_pointer_T_ first__{this};
+                    base_pointer_T_ last__{this};
+                    base_pointer_T_ layer_first__{this};
+                    base_pointer_T_ layer_last__{this};
+                    while (next_layer_M_(first__, last__))
+                    {
+                        first__->entangle_find_prev_cousin_M_(layer_first__);
+                        last__->entangle_find_next_cousin_M_(layer_last__);
+                        layer_first__ = first__;
+                        layer_last__ = last__;
+                    }
+                }
             }
 
         };
@@ -419,64 +1015,84 @@ namespace trl
          * @brief
          * an actual node in the tree.
          */
-        template <typename ValTp__>
+        template <typename ValTp__, typename Policy__>
         struct flex_tree_node__ 
-            : public flex_tree_node_base__
+            : public flex_tree_node_base__<Policy__>
         {
             ValTp__ value_M_;
             
             template <typename... Args>
-            flex_tree_node__(Args&&... args__) : value_M_(args__...) { }
+            flex_tree_node__(Args&&... args__) : value_M_(std::forward<Args>(args__)...) { }
         };
 
         /**
          * @brief
-         * wrapper for a flex_tree_node__ and a total subnode-count (children and it's children and so on).
+         * one element of a braced initializer-list for a flex_tree: the arguments for a node's value and it's child-initializers.
          *
          * @details
-         * because of the recursive initialization using std::initializer_list, the nodes cannot be allocated using the
-         * allocator of the tree, therefore this is only viable for allocators where every instance is interchangeable or at least default-constructible.
-         * 
-         * this wrapper doesn't clean up after it's resources because ownership is transferred to an associated tree that instantiated this wrapper.
-         *
+         * the initializer does not allocate anything by itself. it only refers to the constructor-arguments and to the 
+         * initializer-list of it's children, which all live until the end of the full-expression that constructs the tree.
+         * the tree then allocates every node through it's own allocator, see flex_tree_base__::from_initializer_list_M_().
          */
-        template <typename Alloc__>
-            requires std::default_initializable<Alloc__>
+        template <typename Alloc__, typename Policy__>
         struct flex_tree_node_initializer__
         {
-            using node_T_ = flex_tree_node__<typename Alloc__::value_type>;
+            using value_T_ = typename std::allocator_traits<Alloc__>::value_type;
+            using node_T_ = flex_tree_node__<value_T_, Policy__>;
             using node_ptr_T_ = node_T_*;
             using node_alloc_T_ = std::allocator_traits<Alloc__>::template rebind_alloc<node_T_>;
 
-            node_ptr_T_ ptr_M_{nullptr};
-            flex_tree_node_initializer__* children_M_{nullptr};
-            std::size_t node_count_M_{0ull};
+            static constexpr std::size_t max_args_M_{4ull};
 
-            /* non-copyable */
-            flex_tree_node_initializer__(const flex_tree_node_initializer__&) = delete;
+            /* type-erased addresses of the constructor-arguments, and the function that knows their types */
+            const void* args_M_[max_args_M_]{};
+            node_ptr_T_ (*make_M_)(node_alloc_T_&, const void* const*){nullptr};
+            std::initializer_list<flex_tree_node_initializer__> children_M_{};
 
-            template <typename... Args>
-            static node_ptr_T_
-            get_node_M_(Args&&... args__)
-            {
-                node_alloc_T_ alloc__;
-                node_ptr_T_ new__ = std::allocator_traits<node_alloc_T_>::allocate(alloc__, 1);
-                std::allocator_traits<node_alloc_T_>::construct(alloc__, new__, std::forward<Args>(args__)...);
-                return new__;
-            }
+            /* non-copyable, it refers to temporaries */
+            flex_tree_node_initializer__(const flex_tree_node_initializer__&) = delete;
+            flex_tree_node_initializer__& operator=(const flex_tree_node_initializer__&) = delete;
 
             template <typename... Args>
+                requires (sizeof...(Args) <= max_args_M_) && std::constructible_from<value_T_, Args...>
             flex_tree_node_initializer__(Args&&... args__) 
-            { this->ptr_M_ = get_node_M_(std::forward<Args>(args__)...); }
+                : args_M_{ static_cast<const void*>(std::addressof(args__))... }
+                , make_M_(&make_node_from_M_<Args...>)
+            { }
 
             template <typename Arg>
+                requires std::constructible_from<value_T_, Arg>
             flex_tree_node_initializer__(Arg&& arg__, std::initializer_list<flex_tree_node_initializer__> ilist__)
-                : node_count_M_(ilist__.size())
+                : args_M_{ static_cast<const void*>(std::addressof(arg__)) }
+                , make_M_(&make_node_from_M_<Arg>)
+                , children_M_(ilist__)
+            { }
+
+            /**
+             * @brief allocates and constructs the node this initializer describes.
+             */
+            node_ptr_T_
+            make_node_M_(node_alloc_T_& alloc__) const
+            { return this->make_M_(alloc__, this->args_M_); }
+
+            template <typename... Args>
+            static node_ptr_T_
+            make_node_from_M_(node_alloc_T_& alloc__, const void* const* args__)
+            { return make_node_from_M_<Args...>(alloc__, args__, std::index_sequence_for<Args...>{}); }
+
+            template <typename... Args, std::size_t... Idx>
+            static node_ptr_T_
+            make_node_from_M_(node_alloc_T_& alloc__, const void* const* args__, std::index_sequence<Idx...>)
             {
-                this->ptr_M_ = get_node_M_(std::forward<Arg>(arg__));
-                children_M_ = new flex_tree_node_initializer__[node_count_M_]; /* later cleaned up by header_node::from_ilist */
-                for (std::size_t i__ = 0; i__ < node_count_M_; ++i__)
-                { children_M_[i__] = ilist__.begin()[i__]; }
+                node_ptr_T_ new__ = std::allocator_traits<node_alloc_T_>::allocate(alloc__, 1);
+                try
+                {
+                    std::allocator_traits<node_alloc_T_>::construct(alloc__, new__, 
+                        std::forward<Args>(*static_cast<std::remove_reference_t<Args>*>(const_cast<void*>(args__[Idx])))...);
+                }
+                catch (...)
+                { std::allocator_traits<node_alloc_T_>::deallocate(alloc__, new__, 1); throw; }
+                return new__;
             }
         };
 
@@ -486,51 +1102,210 @@ namespace trl
          * @details
          * does not contain an instance of the value_type of the tree,
          * but only traversal-pointers to hold the top-layer child-nodes.
+         * with layer-links it also keeps the ends of the deepest depth-layer, where breadth-first-order ends.
+         * counts the modifications of the tree, so structures built from it (e.g. trl::ancestor_table) can tell they are out of date.
          */
+        template <typename Policy__>
         struct flex_tree_header_node__ 
-            : public flex_tree_node_base__
+            : public flex_tree_node_base__<Policy__>
         {
-            using base_pointer_T_ = flex_tree_node_base__*;
+            using base_pointer_T_ = flex_tree_node_base__<Policy__>*;
 
             std::size_t size_M_{0ull};
+            /* increased by every allocation, release and move of a node of the tree, and by every splice */
+            std::size_t modifications_M_{0ull};
+            /* first and last node of the deepest depth-layer and the number of layers, the header itself and 0 if empty */
+            [[no_unique_address]] flex_tree_field__<Policy__::layer_links, base_pointer_T_, 7> deepest_first_M_{this};
+            [[no_unique_address]] flex_tree_field__<Policy__::layer_links, base_pointer_T_, 8> deepest_last_M_{this};
+            [[no_unique_address]] flex_tree_field__<Policy__::layer_links, std::size_t, 9> height_M_{0ull};
 
             flex_tree_header_node__() = default;
 
-            template <typename Alloc__>
-            void 
-            process_initializer_M_(base_pointer_T_ cur__, const flex_tree_node_initializer__<Alloc__>& init__)
+            /* the cyclic pointers would point into the other header */
+            flex_tree_header_node__(const flex_tree_header_node__&) = delete;
+            flex_tree_header_node__& operator=(const flex_tree_header_node__&) = delete;
+
+            /**
+             * takes over all nodes of another header, which is left empty. 
+             * only the top-level nodes point back to their header, so this costs O(top-level nodes).
+             * expects this header to be empty.
+             */
+            void
+            take_children_M_(flex_tree_header_node__& o__) noexcept
             {
-                init__.ptr_M_->hook_as_last_child_M_(cur__);
-                ++this->size_M_;
-                if (init__.children_M_)
+                ++this->modifications_M_;
+                ++o__.modifications_M_;
+                if (o__.has_children_M_())
                 {
-                    for (std::size_t i__ = 0; i__ < init__.node_count_M_; ++i__)
-                    { process_initializer_M_(init__.ptr_M_, init__.children_M_[i__]); }
+                    this->first_child_M_ = o__.first_child_M_;
+                    this->last_child_M_ = o__.last_child_M_;
+                    this->child_count_M_ = o__.child_count_M_;
+                    base_pointer_T_ iter__{this->first_child_M_};
+                    while (true)
+                    {
+                        iter__->parent_M_ = this;
+                        if (!iter__->has_next_M_()) { break; }
+                        iter__ = iter__->next_M_;
+                    }
+                    o__.clear_children_M_();
+                    if constexpr (Policy__::layer_links)
+                    {
+                        this->deepest_first_M_ = o__.deepest_first_M_;
+                        this->deepest_last_M_ = o__.deepest_last_M_;
+                        this->height_M_ = o__.height_M_;
+                        o__.forget_layers_M_();
+                    }
                 }
-                delete [] init__.children_M_;
+                this->size_M_ = o__.size_M_;
+                o__.size_M_ = 0ull;
             }
 
-            template <typename Alloc__>
-            void 
-            from_initializer_list_M_(std::initializer_list<flex_tree_node_initializer__<Alloc__>> ilist__)
+            /*
+             * bookkeeping of the modifiers, which report every node they link into or cut out of the tree together with it's descendants.
+             * keeps the ends of the deepest layer with layer-links: the descendants occupy a contiguous range on every layer below the node,
+             * only the ranges on the deepest layer can move it's ends. also keeps the subtree-sizes of the ancestors 
+             * and the labels of flex_tree_policy::ancestor_index, so no modifier has to update them itself.
+             */
+
+            /* the tree is empty */
+            void
+            forget_layers_M_() noexcept
+            {
+                this->deepest_first_M_ = this;
+                this->deepest_last_M_ = this;
+                this->height_M_ = 0ull;
+            }
+
+            /* looks for the deepest layer from the top, for trees that were built without reporting their nodes. O(n) at most. */
+            void
+            find_layers_M_() noexcept
+            {
+                if constexpr (Policy__::layer_links)
+                {
+                    base_pointer_T_ first__{this};
+                    base_pointer_T_ last__{this};
+                    std::size_t height__{0ull};
+                    while (flex_tree_node_base__<Policy__>::next_layer_M_(first__, last__))
+                    { ++height__; }
+                    this->deepest_first_M_ = first__;
+                    this->deepest_last_M_ = last__;
+                    this->height_M_ = height__;
+                }
+            }
+
+            /* 
+             * node__ was linked into the tree with all of it's descendants, nodes__ nodes in total. 
+             * a range that is alone on it's layer opened a new deepest layer, a range behind the last 
+             * or in front of the first node of the deepest layer becomes it's new end. O(1) for leaves.
+             * the ancestors grow by nodes__ and the subtree is labelled, node__ has to know it's own subtree-size already.
+             */
+            void
+            hooked_M_(base_pointer_T_ node__, std::size_t nodes__) noexcept
+            {
+                if constexpr (Policy__::subtree_size)
+                { node__->grow_ancestors_M_(nodes__); }
+                if constexpr (Policy__::ancestor_index)
+                { node__->index_subtree_M_(nodes__); }
+                if constexpr (Policy__::layer_links)
+                {
+                    base_pointer_T_ first__{node__};
+                    base_pointer_T_ last__{node__};
+                    do
+                    {
+                        if (!first__->has_prev_M_() && !last__->has_next_M_())
+                        {
+                            this->deepest_first_M_ = first__;
+                            this->deepest_last_M_ = last__;
+                            ++this->height_M_;
+                        }
+                        else if (first__->has_prev_M_() && first__->prev_M_ == this->deepest_last_M_)
+                        { this->deepest_last_M_ = last__; }
+                        else if (last__->has_next_M_() && last__->next_M_ == this->deepest_first_M_)
+                        { this->deepest_first_M_ = first__; }
+                    }
+                    while (flex_tree_node_base__<Policy__>::next_layer_M_(first__, last__));
+                }
+            }
+
+            /* 
+             * node__ is about to be cut out of the tree with all of it's descendants, while it's layers are still linked.
+             * if a range makes up a whole layer, that layer and every one below it disappear and the rest of the layer above 
+             * becomes the deepest one, whose ends are searched along it (O(width of that layer)). O(1) for leaves otherwise.
+             */
+            void
+            unhooking_M_(base_pointer_T_ node__) noexcept
             {
-                for (const flex_tree_node_initializer__<Alloc__>& init__ : ilist__)
-                { this->process_initializer_M_<Alloc__>(this, init__); }
+                if constexpr (Policy__::subtree_size)
+                { node__->shrink_ancestors_M_(node__->subtree_size_M_); }
+                if constexpr (Policy__::layer_links)
+                {
+                    base_pointer_T_ first__{node__};
+                    base_pointer_T_ last__{node__};
+                    /* the range of the subtree on the layer above, nullptr for the layer of node__ */
+                    base_pointer_T_ cut_first__{nullptr};
+                    base_pointer_T_ cut_last__{nullptr};
+                    do
+                    {
+                        if (!first__->has_prev_M_() && !last__->has_next_M_())
+                        {
+                            base_pointer_T_ above_first__{cut_first__ ? cut_first__ : first__->parent_M_};
+                            base_pointer_T_ above_last__{cut_last__ ? cut_last__ : first__->parent_M_};
+                            while (above_first__->has_prev_M_()) { above_first__ = above_first__->prev_M_; }
+                            while (above_last__->has_next_M_()) { above_last__ = above_last__->next_M_; }
+                            if (above_first__ == cut_first__) { above_first__ = cut_last__->next_M_; }
+                            if (above_last__ == cut_last__) { above_last__ = cut_first__->prev_M_; }
+                            this->deepest_first_M_ = above_first__;
+                            this->deepest_last_M_ = above_last__;
+                            do { --this->height_M_; }
+                            while (flex_tree_node_base__<Policy__>::next_layer_M_(first__, last__));
+                            return;
+                        }
+                        if (last__ == this->deepest_last_M_)
+                        { this->deepest_last_M_ = first__->prev_M_; }
+                        if (first__ == this->deepest_first_M_)
+                        { this->deepest_first_M_ = last__->next_M_; }
+                        cut_first__ = first__;
+                        cut_last__ = last__;
+                    }
+                    while (flex_tree_node_base__<Policy__>::next_layer_M_(first__, last__));
+                }
+            }
+
+            /* node__ was cut out with unhooking_M_() and linked in again somewhere else, e.g. by a splice */
+            void
+            moved_M_(base_pointer_T_ node__) noexcept
+            {
+                if constexpr (Policy__::subtree_size || Policy__::ancestor_index)
+                { this->hooked_M_(node__, flex_tree_node_base__<Policy__>::subtree_size_of_M_(node__)); }
+                else /* the count is only needed for the subtree-sizes and labels */
+                { this->hooked_M_(node__, 1ull); }
+            }
+
+            void
+            swap_M_(flex_tree_header_node__& o__) noexcept
+            {
+                flex_tree_header_node__ tmp__;
+                tmp__.take_children_M_(o__);
+                o__.take_children_M_(*this);
+                this->take_children_M_(tmp__);
             }
         };
 
-        template <typename ValTp__, bool Const__>
+        template <typename ValTp__, typename Policy__, bool Const__>
         struct flex_tree_iterator_base__
         {
-            using iterator_category = std::bidirectional_iterator_tag;
+            /* without prev- and last-child-links, operator-- does not compile */
+            using iterator_category = typename std::conditional<Policy__::prev_link && Policy__::last_child_link, 
+                std::bidirectional_iterator_tag, std::forward_iterator_tag>::type;
             using value_type = typename std::conditional<Const__, const ValTp__, ValTp__>::type;
             using difference_type = std::ptrdiff_t;
             using pointer = value_type*;
             using reference = value_type&;
          
             using self_T_ = flex_tree_iterator_base__;
-            using node_ptr_T_ = typename std::conditional<Const__, const flex_tree_node__<ValTp__>*, flex_tree_node__<ValTp__>*>::type;
-            using base_ptr_T_ = typename std::conditional<Const__, const flex_tree_node_base__*, flex_tree_node_base__*>::type;
+            using policy_T_ = Policy__;
+            using node_ptr_T_ = typename std::conditional<Const__, const flex_tree_node__<ValTp__, Policy__>*, flex_tree_node__<ValTp__, Policy__>*>::type;
+            using base_ptr_T_ = typename std::conditional<Const__, const flex_tree_node_base__<Policy__>*, flex_tree_node_base__<Policy__>*>::type;
 
             base_ptr_T_ ptr_M_{nullptr};
 
@@ -554,26 +1329,26 @@ namespace trl
 
             [[nodiscard]]
             reference 
-            operator*() const TRL_ITER_NOEXCEPT
-            {
-            #if !defined(TRL_FLEX_TREE_NOEXCEPT) && !defined(TRL_FLEX_TREE_ITER_NOEXCEPT)
-                if (this->ptr_M_->is_root_M_()) 
-                { throw std::logic_error("cannot dereference end()-iterator"); }
-            #else
-                assert(!this->ptr_M_->is_root_M_()); /* downcast will cause UB on end()-node. check only in debug. */
-            #endif
+            operator*() const noexcept(!Policy__::iterator_exceptions)
+            {
+                if constexpr (Policy__::iterator_exceptions)
+                {
+                    if (this->ptr_M_->is_root_M_()) 
+                    { throw std::logic_error("cannot dereference end()-iterator"); }
+                }
+                else
+                { assert(!this->ptr_M_->is_root_M_()); /* downcast will cause UB on end()-node. check only in debug. */ }
                 return static_cast<node_ptr_T_>(this->ptr_M_)->value_M_; 
             }
             
             [[nodiscard]]
             pointer 
-            operator->() const TRL_ITER_NOEXCEPT
+            operator->() const noexcept(!Policy__::iterator_exceptions)
             { 
-            #if !defined(TRL_FLEX_TREE_NOEXCEPT) && !defined(TRL_FLEX_TREE_ITER_NOEXCEPT)
-                if (this->ptr_M_->is_root_M_()) { throw std::logic_error("cannot dereference end()-iterator"); }
-            #else
-                assert(!this->ptr_M_->is_root_M_()); /* downcast will cause UB on end()-node. check only in debug. */
-            #endif
+                if constexpr (Policy__::iterator_exceptions)
+                { if (this->ptr_M_->is_root_M_()) { throw std::logic_error("cannot dereference end()-iterator"); } }
+                else
+                { assert(!this->ptr_M_->is_root_M_()); /* downcast will cause UB on end()-node. check only in debug. */ }
                 return std::addressof(static_cast<node_ptr_T_>(this->ptr_M_)->value_M_); 
             }
 
@@ -603,18 +1378,18 @@ namespace trl
          * @brief an iterator to a flex_tree.
          * @tparam Traversal the algorithm used to traverse the tree.
          */
-        template <traversal Trav__, typename ValTp__, bool Const__>
+        template <traversal Trav__, typename ValTp__, typename Policy__, bool Const__>
         struct flex_tree_iterator__; /* primary template. not to be instantiated. */
 
         /**
          * @brief partial-specialization for depth-first-pre-order traversal.
          */
-        template <typename ValTp__, bool Const__>
-        struct flex_tree_iterator__<depth_first_pre_order, ValTp__, Const__>
-            : public flex_tree_iterator_base__<ValTp__, Const__>
+        template <typename ValTp__, typename Policy__, bool Const__>
+        struct flex_tree_iterator__<depth_first_pre_order, ValTp__, Policy__, Const__>
+            : public flex_tree_iterator_base__<ValTp__, Policy__, Const__>
         {
-            using self_T_ = flex_tree_iterator__<depth_first_pre_order, ValTp__, Const__>;
-            using base_T_ = flex_tree_iterator_base__<ValTp__, Const__>;
+            using self_T_ = flex_tree_iterator__<depth_first_pre_order, ValTp__, Policy__, Const__>;
+            using base_T_ = flex_tree_iterator_base__<ValTp__, Policy__, Const__>;
             using base_T_::base_T_; /* use constructors of base-class */
 
             /*
@@ -622,15 +1397,22 @@ namespace trl
              * iterators (promoted to const), but not vice-versa. 
              */
 
-            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, false>& other) noexcept 
+            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, false>& other) noexcept 
                 requires Const__
                 : base_T_(other.ptr_M_)
             { }
 
-            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Const__>& other) noexcept
+            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, Const__>& other) noexcept
                 : base_T_(other.ptr_M_)
             { }
 
+            /**
+             * @return the first node in pre-order below root__, or root__ if it has no child-nodes.
+             */
+            static typename base_T_::base_ptr_T_
+            first_M_(typename base_T_::base_ptr_T_ root__) noexcept
+            { return root__->first_child_M_; }
+
             self_T_& 
             operator++() noexcept
             { 
@@ -643,7 +1425,7 @@ namespace trl
             }
 
             self_T_&
-            operator--() noexcept
+            operator--() noexcept requires (Policy__::prev_link && Policy__::last_child_link)
             { 
                 if (this->ptr_M_->is_first_child_M_() && !this->ptr_M_->is_root_M_())
                 { this->ptr_M_ = this->ptr_M_->parent_M_; return *this; }
@@ -658,49 +1440,171 @@ namespace trl
             { self_T_ old{*this}; ++(*this); return old; }
 
             self_T_
-            operator--(int) noexcept
+            operator--(int) noexcept requires (Policy__::prev_link && Policy__::last_child_link)
             { self_T_ old{*this}; --(*this); return old; }
 
         };
 
         /**
-         * @brief partial-specialization for breadth-first-in-order traversal.
+         * @brief 
+         * partial-specialization for depth-first-post-order traversal.
+         * every node is visited after all of it's descendants, the header (end()) comes last.
          */
-        template <typename ValTp__, bool Const__>
-        struct flex_tree_iterator__<breadth_first_in_order, ValTp__, Const__>
-            : public flex_tree_iterator_base__<ValTp__, Const__>
+        template <typename ValTp__, typename Policy__, bool Const__>
+        struct flex_tree_iterator__<depth_first_post_order, ValTp__, Policy__, Const__>
+            : public flex_tree_iterator_base__<ValTp__, Policy__, Const__>
         {
-            using self_T_ = flex_tree_iterator__<breadth_first_in_order, ValTp__, Const__>;
-            using base_T_ = flex_tree_iterator_base__<ValTp__, Const__>;
+            using self_T_ = flex_tree_iterator__<depth_first_post_order, ValTp__, Policy__, Const__>;
+            using base_T_ = flex_tree_iterator_base__<ValTp__, Policy__, Const__>;
             using base_T_::base_T_; /* use constructors of base-class */
 
-            bool direction_M_{false};
-
             /*
              * const-iterators can be constructed from regular 
              * iterators (promoted to const), but not vice-versa. 
              */
 
-            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, false>& other) noexcept 
+            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, false>& other) noexcept 
                 requires Const__
                 : base_T_(other.ptr_M_)
             { }
 
-            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Const__>& other) noexcept
+            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, Const__>& other) noexcept
                 : base_T_(other.ptr_M_)
             { }
 
+            /**
+             * @return the first node in post-order below root__ (it's left-most leaf), or root__ if it has no child-nodes.
+             */
+            static typename base_T_::base_ptr_T_
+            first_M_(typename base_T_::base_ptr_T_ root__) noexcept
+            { 
+                while (root__->has_children_M_())
+                { root__ = root__->first_child_M_; }
+                return root__;
+            }
+
+            /* 
+             * amortized O(1): every edge is walked down once and up once over a full traversal. 
+             * next_M_/prev_M_ are only followed for nodes that are not the last/first child, 
+             * so they always point to a sibling and never to a cousin.
+             */
+
             self_T_& 
             operator++() noexcept
             { 
-                if (this->ptr_M_->depth_M_() % 2)
+                if (this->ptr_M_->is_root_M_())
+                { this->ptr_M_ = first_M_(this->ptr_M_); return *this; }
+                if (this->ptr_M_->is_last_child_M_())
+                { this->ptr_M_ = this->ptr_M_->parent_M_; return *this; }
+                this->ptr_M_ = first_M_(this->ptr_M_->next_M_);
+                return *this;
+            }
+
+            self_T_&
+            operator--() noexcept requires (Policy__::prev_link && Policy__::last_child_link)
+            { 
+                if (this->ptr_M_->has_children_M_())
+                { this->ptr_M_ = this->ptr_M_->last_child_M_; return *this; }
+                while (this->ptr_M_->is_first_child_M_() && !this->ptr_M_->is_root_M_())
+                { this->ptr_M_ = this->ptr_M_->parent_M_; }
+                this->ptr_M_ = this->ptr_M_->prev_M_;
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept requires (Policy__::prev_link && Policy__::last_child_link)
+            { self_T_ old{*this}; --(*this); return old; }
+
+        };
+
+        /**
+         * @brief 
+         * partial-specialization for breadth-first-in-order and breadth-first-reverse-order traversal.
+         * @details
+         * the layers are walked in alternating directions, starting left-to-right (in-order) or 
+         * right-to-left (reverse-order) on the top-layer, so moving on to the next layer never has 
+         * to walk back across the current one.
+         * the direction of the current layer is kept in the iterator, so a step costs amortized O(1) 
+         * regardless of the depth of the tree. only constructing the iterator from a plain node
+         * (or another traversal's iterator) has to determine the depth of that node once.
+         */
+        template <traversal Trav__, typename ValTp__, typename Policy__, bool Const__>
+            requires (Trav__ == breadth_first_in_order || Trav__ == breadth_first_reverse_order) && (Policy__::layer_links)
+        struct flex_tree_iterator__<Trav__, ValTp__, Policy__, Const__>
+            : public flex_tree_iterator_base__<ValTp__, Policy__, Const__>
+        {
+            using self_T_ = flex_tree_iterator__<Trav__, ValTp__, Policy__, Const__>;
+            using base_T_ = flex_tree_iterator_base__<ValTp__, Policy__, Const__>;
+            using base_ptr_T_ = typename base_T_::base_ptr_T_;
+
+            static constexpr bool reversed_M_{Trav__ == breadth_first_reverse_order};
+
+            /* 
+             * true while the current layer is walked left-to-right (along next_M_). 
+             * that is every odd depth for in-order and every even depth for reverse-order, 
+             * the header counts as depth 0.
+             */
+            bool direction_M_{reversed_M_};
+
+            flex_tree_iterator__() = default;
+
+            explicit flex_tree_iterator__(base_ptr_T_ ptr__) noexcept
+                : base_T_(ptr__)
+                , direction_M_(ptr__ ? static_cast<bool>(ptr__->depth_M_() % 2) != reversed_M_ : reversed_M_)
+            { }
+
+            flex_tree_iterator__(base_ptr_T_ ptr__, bool direction__) noexcept
+                : base_T_(ptr__)
+                , direction_M_(direction__)
+            { }
+
+            /*
+             * const-iterators can be constructed from regular 
+             * iterators (promoted to const), but not vice-versa. 
+             */
+
+            flex_tree_iterator__(const flex_tree_iterator__<Trav__, ValTp__, Policy__, false>& other) noexcept 
+                requires Const__
+                : base_T_(other.ptr_M_)
+                , direction_M_(other.direction_M_)
+            { }
+
+            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, false>& other) noexcept 
+                requires Const__
+                : flex_tree_iterator__(other.ptr_M_)
+            { }
+
+            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, Const__>& other) noexcept
+                : flex_tree_iterator__(other.ptr_M_)
+            { }
+
+            /**
+             * @return the first node in breadth-first-order below root__, or root__ if it has no child-nodes.
+             */
+            static base_ptr_T_
+            first_M_(base_ptr_T_ root__) noexcept
+            { 
+                if constexpr (reversed_M_)
+                { return root__->last_child_M_; }
+                else
+                { return root__->first_child_M_; }
+            }
+
+            self_T_& 
+            operator++() noexcept
+            { 
+                if (this->direction_M_)
                 {
                     if (this->ptr_M_->has_next_M_())
                     { this->ptr_M_ = this->ptr_M_->next_M_; return *this; }
                     while (!this->ptr_M_->has_children_M_())
                     {
                         if (!this->ptr_M_->has_prev_M_()) 
-                        { this->ptr_M_ = this->ptr_M_->find_root_M_(); return *this; }
+                        { return this->to_end_M_(); }
                         this->ptr_M_ = this->ptr_M_->prev_M_; 
                     }
                     this->ptr_M_ = this->ptr_M_->last_child_M_;
@@ -712,50 +1616,55 @@ namespace trl
                     while (!this->ptr_M_->has_children_M_())
                     {
                         if (!this->ptr_M_->has_next_M_()) 
-                        { this->ptr_M_ = this->ptr_M_->find_root_M_(); return *this; }
+                        { return this->to_end_M_(); }
                         this->ptr_M_ = this->ptr_M_->next_M_; 
                     }
                     this->ptr_M_ = this->ptr_M_->first_child_M_;
                 }
+                this->direction_M_ = !this->direction_M_;
                 return *this;
             }
 
+            /**
+             * @return the last node in breadth-first-order of the tree, or the header if it is empty. O(1).
+             * @param header__ the header of the tree, which keeps the ends of the deepest depth-layer.
+             * @param direction__ receives the direction of the layer the returned node is on.
+             */
+            static base_ptr_T_
+            last_M_(base_ptr_T_ header__, bool& direction__) noexcept
+            {
+                using header_T_ = std::conditional_t<Const__, const flex_tree_header_node__<Policy__>, flex_tree_header_node__<Policy__>>;
+                header_T_* tree_header__{static_cast<header_T_*>(header__)};
+                direction__ = static_cast<bool>(tree_header__->height_M_ % 2) != reversed_M_;
+                return direction__ ? tree_header__->deepest_last_M_ : tree_header__->deepest_first_M_;
+            }
+
             self_T_&
-            operator--() noexcept
+            operator--() noexcept requires (Policy__::prev_link && Policy__::last_child_link)
             {   
                 if (this->ptr_M_->is_root_M_())
-                {
-                    /* 
-                     * extremely slow if operator-- is called on root, because the last
-                     * node in the deepest layer needs to be found. maybe there
-                     * is a smarter way to do this.
-                     *
-                     * maybe just don't implement this at all? as with depth-first?
-                     */
-                    auto iter = this->ptr_M_;
-                    ++(*this);
-                    while (!this->ptr_M_->is_root_M_())
-                    { iter = this->ptr_M_; ++(*this); }
-                    this->ptr_M_ = iter;
-                    return *this;
-                }              
-                if (this->ptr_M_->depth_M_() % 2)
+                { this->ptr_M_ = last_M_(this->ptr_M_, this->direction_M_); return *this; }
+                /* 
+                 * the layer above was walked in the opposite direction, so it's last visited node 
+                 * lies on the same side as the first visited node of this layer.
+                 */
+                if (this->direction_M_)
                 {
                     if (this->ptr_M_->has_prev_M_())
                     { this->ptr_M_ = this->ptr_M_->prev_M_; return *this; }
                     this->ptr_M_ = this->ptr_M_->parent_M_;
-                    while (this->ptr_M_->has_next_M_())
-                    { this->ptr_M_ = this->ptr_M_->next_M_; }
+                    while (this->ptr_M_->has_prev_M_())
+                    { this->ptr_M_ = this->ptr_M_->prev_M_; }
                 }
                 else
                 {
                     if (this->ptr_M_->has_next_M_())
                     { this->ptr_M_ = this->ptr_M_->next_M_; return *this; }
                     this->ptr_M_ = this->ptr_M_->parent_M_;
-                    while (this->ptr_M_->has_prev_M_())
-                    { this->ptr_M_ = this->ptr_M_->prev_M_; }
-
+                    while (this->ptr_M_->has_next_M_())
+                    { this->ptr_M_ = this->ptr_M_->next_M_; }
                 }
+                this->direction_M_ = !this->direction_M_;
                 return *this;
             }
 
@@ -764,14 +1673,190 @@ namespace trl
             { self_T_ old{*this}; ++(*this); return old; }
 
             self_T_
-            operator--(int) noexcept
+            operator--(int) noexcept requires (Policy__::prev_link && Policy__::last_child_link)
             { self_T_ old{*this}; --(*this); return old; }
+
+        private:
+
+            /* the last node of the last layer was passed, the traversal continues at the header (depth 0) */
+            self_T_&
+            to_end_M_() noexcept
+            {
+                this->ptr_M_ = this->ptr_M_->find_root_M_();
+                this->direction_M_ = reversed_M_;
+                return *this;
+            }
+        };
+
+        /**
+         * @brief
+         * true for the breadth-first iterators of trees without layer-links, which keep the layers they walk in std::vectors.
+         * constructing one from a node is O(n) and may throw std::bad_alloc, so flex_tree's insertion-modifiers only take
+         * and return iterators of the other traversals for such trees, convert explicitly (e.g. `iterator<>(where)`) instead.
+         */
+        template <traversal Trav__, typename Policy__>
+        inline constexpr bool stacked_breadth_first__{!Policy__::layer_links && (Trav__ == breadth_first_in_order || Trav__ == breadth_first_reverse_order)};
+
+        /**
+         * @brief 
+         * partial-specialization for breadth-first traversal of trees without layer-links (see trl::flex_tree_policy).
+         * @details
+         * visits the nodes in the same alternating order as the specialization above. next_M_/prev_M_ only connect 
+         * siblings here, so the iterator keeps two stacks instead: the rest of the current layer in visiting order, 
+         * and the child-nodes of the already visited nodes, pushed so that the next layer pops off in the opposite direction.
+         * a step costs amortized O(1), but the iterator owns O(width) memory, which makes copies expensive.
+         * it is a forward-iterator only, and any modification of the tree invalidates it 
+         * (except erasing the node it points to through flex_tree::erase(), which returns the next one).
+         * constructing it from a plain node has to rebuild the layers above that node once, in O(n).
+         * that's why the modifiers that return an iterator to a new node don't accept it, see stacked_breadth_first__.
+         */
+        template <traversal Trav__, typename ValTp__, typename Policy__, bool Const__>
+            requires (Trav__ == breadth_first_in_order || Trav__ == breadth_first_reverse_order) && (!Policy__::layer_links)
+        struct flex_tree_iterator__<Trav__, ValTp__, Policy__, Const__>
+            : public flex_tree_iterator_base__<ValTp__, Policy__, Const__>
+        {
+            using iterator_category = std::forward_iterator_tag;
+            using self_T_ = flex_tree_iterator__<Trav__, ValTp__, Policy__, Const__>;
+            using base_T_ = flex_tree_iterator_base__<ValTp__, Policy__, Const__>;
+            using base_ptr_T_ = typename base_T_::base_ptr_T_;
+
+            static constexpr bool reversed_M_{Trav__ == breadth_first_reverse_order};
+
+            /* true while the current layer is walked left-to-right, the header counts as depth 0 */
+            bool direction_M_{reversed_M_};
+            /* the nodes of the current layer that are still to be visited, the next one on top */
+            std::vector<base_ptr_T_> layer_M_{};
+            /* the child-nodes of the visited nodes of the current layer */
+            std::vector<base_ptr_T_> next_layer_M_{};
+
+            flex_tree_iterator__() = default;
+
+            explicit flex_tree_iterator__(base_ptr_T_ ptr__)
+                : base_T_(ptr__)
+            { 
+                if (ptr__ && !ptr__->is_root_M_())
+                { this->seek_M_(); }
+            }
+
+            /*
+             * const-iterators can be constructed from regular 
+             * iterators (promoted to const), but not vice-versa. 
+             */
+
+            flex_tree_iterator__(const flex_tree_iterator__<Trav__, ValTp__, Policy__, false>& other) 
+                requires Const__
+                : base_T_(other.ptr_M_)
+                , direction_M_(other.direction_M_)
+                , layer_M_(other.layer_M_.begin(), other.layer_M_.end())
+                , next_layer_M_(other.next_layer_M_.begin(), other.next_layer_M_.end())
+            { }
+
+            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, false>& other) 
+                requires Const__
+                : flex_tree_iterator__(other.ptr_M_)
+            { }
+
+            flex_tree_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, Const__>& other)
+                : flex_tree_iterator__(other.ptr_M_)
+            { }
+
+            /**
+             * @return the first node in breadth-first-order below root__, or root__ if it has no child-nodes.
+             */
+            static base_ptr_T_
+            first_M_(base_ptr_T_ root__) noexcept
+            { 
+                if constexpr (reversed_M_)
+                { return flex_tree_node_base__<Policy__>::last_child_of_M_(root__); }
+                else
+                { return root__->first_child_M_; }
+            }
+
+            self_T_& 
+            operator++()
+            { 
+                this->push_children_M_(this->ptr_M_);
+                if (this->layer_M_.empty())
+                {
+                    if (this->next_layer_M_.empty())
+                    {
+                        this->ptr_M_ = this->ptr_M_->find_root_M_();
+                        this->direction_M_ = reversed_M_;
+                        return *this;
+                    }
+                    this->layer_M_.swap(this->next_layer_M_);
+                    this->direction_M_ = !this->direction_M_;
+                }
+                this->ptr_M_ = this->layer_M_.back();
+                this->layer_M_.pop_back();
+                return *this;
+            }
+
+            self_T_
+            operator++(int)
+            { self_T_ old{*this}; ++(*this); return old; }
+
+        private:
+
+            /* 
+             * pushes the child-nodes of a visited node in the direction of it's layer.
+             * the next layer is walked the other way around, so it pops off in the right order.
+             */
+            void
+            push_children_M_(base_ptr_T_ node__)
+            {
+                if (!node__->has_children_M_()) 
+                { return; }
+                if (this->direction_M_ || !Policy__::prev_link)
+                {
+                    std::size_t pushed__{this->next_layer_M_.size()};
+                    for (base_ptr_T_ iter__{node__->first_child_M_}; ; iter__ = iter__->next_M_)
+                    { this->next_layer_M_.push_back(iter__); if (iter__->is_last_child_M_()) { break; } }
+                    if (!this->direction_M_) /* no prev-links to walk the siblings backwards */
+                    { std::reverse(this->next_layer_M_.begin() + pushed__, this->next_layer_M_.end()); }
+                }
+                else if constexpr (Policy__::prev_link)
+                {
+                    for (base_ptr_T_ iter__{flex_tree_node_base__<Policy__>::last_child_of_M_(node__)}; ; iter__ = iter__->prev_M_)
+                    { this->next_layer_M_.push_back(iter__); if (iter__ == node__->first_child_M_) { break; } }
+                }
+            }
+
+            /* 
+             * restores the stacks for a node that was not reached by iteration: collects it's layer 
+             * from the header down, pushes the children of the nodes visited before it and queues the ones after it. O(n).
+             */
+            void
+            seek_M_()
+            {
+                std::size_t depth__{this->ptr_M_->depth_M_()};
+                std::vector<base_ptr_T_> layer__{this->ptr_M_->find_root_M_()};
+                for (std::size_t i__{0ull}; i__ < depth__; ++i__)
+                {
+                    std::vector<base_ptr_T_> below__;
+                    for (base_ptr_T_ node__ : layer__)
+                    {
+                        if (!node__->has_children_M_()) { continue; }
+                        for (base_ptr_T_ iter__{node__->first_child_M_}; ; iter__ = iter__->next_M_)
+                        { below__.push_back(iter__); if (iter__->is_last_child_M_()) { break; } }
+                    }
+                    layer__.swap(below__);
+                }
+
+                this->direction_M_ = static_cast<bool>(depth__ % 2) != reversed_M_;
+                if (!this->direction_M_) /* layer__ in visiting order */
+                { std::reverse(layer__.begin(), layer__.end()); }
+                auto where__ = std::find(layer__.begin(), layer__.end(), this->ptr_M_);
+                for (auto iter__ = layer__.begin(); iter__ != where__; ++iter__)
+                { this->push_children_M_(*iter__); }
+                this->layer_M_.assign(layer__.rbegin(), std::make_reverse_iterator(where__ + 1));
+            }
         };
 
         /**
          * @details
          * custom reverse-iterator adaptor for flex_tree::iterator.
-         * for STL std::reverse_iterator-compliance, use TRL_FLEX_TREE_STL_REVERSE_ITER.
+         * for STL std::reverse_iterator-compliance, use flex_tree_policy::stl_reverse_iterator (TRL_FLEX_TREE_STL_REVERSE_ITER).
          *
          * the rationale behind this custom adaptor is the way std::reverse_iterator handles dereferences
          * and works internally. std::reverse_iterator(tree.end()) would hold an instance of an end()-iterator
@@ -779,10 +1864,10 @@ namespace trl
          * as this dereference requires invoking the iteration-algorithm each time, potentially causing large overhead
          * if the structure of the tree is unfortunate enough.
          */
-        template <traversal Trav__, typename ValTp__, bool Const__>
+        template <traversal Trav__, typename ValTp__, typename Policy__, bool Const__>
         struct flex_tree_reverse_iterator__
         {
-            using base_type = flex_tree_iterator__<Trav__, ValTp__, Const__>;
+            using base_type = flex_tree_iterator__<Trav__, ValTp__, Policy__, Const__>;
             using iterator_category = typename base_type::iterator_category;
             using value_type = typename base_type::value_type;
             using difference_type = typename base_type::difference_type;
@@ -790,7 +1875,7 @@ namespace trl
             using reference = typename base_type::reference;
 
             using self_T_ = flex_tree_reverse_iterator__;
-            using base_T_ = flex_tree_iterator_base__<ValTp__, Const__>;
+            using base_T_ = flex_tree_iterator_base__<ValTp__, Policy__, Const__>;
             using self_ref_T_ = self_T_&;
             using c_self_ref_T_ = const self_T_&;
 
@@ -803,12 +1888,12 @@ namespace trl
              * iterators (promoted to const), but not vice-versa. 
              */
 
-            flex_tree_reverse_iterator__(const flex_tree_iterator_base__<ValTp__, false>& other) noexcept 
+            flex_tree_reverse_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, false>& other) noexcept 
                 requires Const__
                 : instance_M_(other.ptr_M_)
             { }
 
-            flex_tree_reverse_iterator__(const flex_tree_iterator_base__<ValTp__, Const__>& other) noexcept
+            flex_tree_reverse_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, Const__>& other) noexcept
                 : instance_M_(other.ptr_M_)
             { }
 
@@ -845,12 +1930,12 @@ namespace trl
 
             [[nodiscard]]
             reference 
-            operator*() const TRL_ITER_NOEXCEPT
+            operator*() const noexcept(!Policy__::iterator_exceptions)
             { return *this->instance_M_; }
             
             [[nodiscard]]
             pointer 
-            operator->() const TRL_ITER_NOEXCEPT
+            operator->() const noexcept(!Policy__::iterator_exceptions)
             { return std::addressof(*this->instance_M_); }
 
             friend bool
@@ -871,12 +1956,12 @@ namespace trl
          * this template is to be used with `trl::<tree_type>::node_traits::lbegin()`/`lend()` 
          * as in leaf-begin and leaf-end that define the bounds of the range.
          */
-        template <typename ValTp__, bool Const__>
+        template <typename ValTp__, typename Policy__, bool Const__>
         struct flex_tree_leaf_iterator__
-            : public flex_tree_iterator_base__<ValTp__, Const__>
+            : public flex_tree_iterator_base__<ValTp__, Policy__, Const__>
         {
             using self_T_ = flex_tree_leaf_iterator__;
-            using base_T_ = flex_tree_iterator_base__<ValTp__, Const__>;
+            using base_T_ = flex_tree_iterator_base__<ValTp__, Policy__, Const__>;
             using base_T_::base_T_; /* use constructors of base-class */
 
             /*
@@ -884,12 +1969,12 @@ namespace trl
              * iterators (promoted to const), but not vice-versa. 
              */
 
-            flex_tree_leaf_iterator__(const flex_tree_iterator_base__<ValTp__, false>& other) noexcept 
+            flex_tree_leaf_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, false>& other) noexcept 
                 requires Const__
                 : base_T_(other.ptr_M_)
             { }
 
-            flex_tree_leaf_iterator__(const flex_tree_iterator_base__<ValTp__, Const__>& other) noexcept
+            flex_tree_leaf_iterator__(const flex_tree_iterator_base__<ValTp__, Policy__, Const__>& other) noexcept
                 : base_T_(other.ptr_M_)
             { }
 
@@ -903,7 +1988,7 @@ namespace trl
             }
 
             self_T_&
-            operator--() noexcept
+            operator--() noexcept requires (Policy__::prev_link && Policy__::last_child_link)
             { 
                 this->ptr_M_ = 
                 this->ptr_M_->is_first_child_M_() ? 
@@ -916,7 +2001,7 @@ namespace trl
             { self_T_ old{*this}; ++(*this); return old; }
 
             self_T_
-            operator--(int) noexcept
+            operator--(int) noexcept requires (Policy__::prev_link && Policy__::last_child_link)
             { self_T_ old{*this}; --(*this); return old; }
 
         };
@@ -925,77 +2010,73 @@ namespace trl
          * @brief
          * provides (optionally exception-safe) information about a node's placement in a tree.
          */
+        template <typename Policy__>
         struct flex_tree_node_traits__
         {
 
             template <typename IteratorType>
             static IteratorType
-            parent(IteratorType iter) TRL_NOEXCEPT
+            parent(IteratorType iter) noexcept(!Policy__::exceptions)
             {
                 auto ptr__ = iter.ptr_M_;
-            #ifndef TRL_NODE_TRAITS_NOEXCEPT
-                if (ptr__->is_root_M_()) { throw std::logic_error("root-node cannot have a parent-node"); }
-            #else
-                assert(!ptr__->is_root_M_()); 
-            #endif
-                return IteratorType(ptr__);
+                if constexpr (Policy__::exceptions)
+                { if (ptr__->is_root_M_()) { throw std::logic_error("root-node cannot have a parent-node"); } }
+                else
+                { assert(!ptr__->is_root_M_()); }
+                return IteratorType(ptr__->parent_M_);
             }
 
             template <typename IteratorType>
             static IteratorType
-            next(IteratorType iter) TRL_NOEXCEPT
+            next(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
-            #ifndef TRL_NODE_TRAITS_NOEXCEPT
-                if (!ptr__->has_next_M_()) { throw std::logic_error("node does not have a next node"); }
-            #else
-                assert(ptr__->has_next_M_()); 
-            #endif
+                if constexpr (Policy__::exceptions)
+                { if (!ptr__->has_next_M_()) { throw std::logic_error("node does not have a next node"); } }
+                else
+                { assert(ptr__->has_next_M_()); }
                 return IteratorType(ptr__->next_M_);
             }
 
             template <typename IteratorType>
             static IteratorType
-            previous(IteratorType iter) TRL_NOEXCEPT
+            previous(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
-            #ifndef TRL_NODE_TRAITS_NOEXCEPT
-                if (!ptr__->has_prev_M_()) { throw std::logic_error("node does not have a previous node"); }
-            #else
-                assert(ptr__->has_prev_M_()); 
-            #endif
+                if constexpr (Policy__::exceptions)
+                { if (!ptr__->has_prev_M_()) { throw std::logic_error("node does not have a previous node"); } }
+                else
+                { assert(ptr__->has_prev_M_()); }
                 return IteratorType(ptr__->prev_M_);
             }
 
             template <typename IteratorType>
             static IteratorType
-            first_child(IteratorType iter) TRL_NOEXCEPT
+            first_child(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
-            #ifndef TRL_NODE_TRAITS_NOEXCEPT
-                if (!ptr__->has_children_M_()) { throw std::logic_error("node does not have any child-nodes"); }
-            #else
-                assert(ptr__->has_children_M_()); 
-            #endif
+                if constexpr (Policy__::exceptions)
+                { if (!ptr__->has_children_M_()) { throw std::logic_error("node does not have any child-nodes"); } }
+                else
+                { assert(ptr__->has_children_M_()); }
                 return IteratorType(ptr__->first_child_M_);
             }
 
             template <typename IteratorType>
             static IteratorType
-            last_child(IteratorType iter) TRL_NOEXCEPT
+            last_child(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
-            #ifndef TRL_NODE_TRAITS_NOEXCEPT
-                if (!ptr__->has_children_M_()) { throw std::logic_error("node does not have any child-nodes"); }
-            #else
-                assert(ptr__->has_children_M_()); 
-            #endif
-                return IteratorType(ptr__->last_child_M_);
+                if constexpr (Policy__::exceptions)
+                { if (!ptr__->has_children_M_()) { throw std::logic_error("node does not have any child-nodes"); } }
+                else
+                { assert(ptr__->has_children_M_()); }
+                return IteratorType(ptr__->last_child_of_M_(ptr__));
             }
 
             template <typename IteratorType>
             static std::size_t 
-            depth(IteratorType iter) TRL_NOEXCEPT
+            depth(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
                 return ptr__->depth_M_(); 
@@ -1003,15 +2084,49 @@ namespace trl
 
             template <typename IteratorType>
             static std::size_t 
-            child_count(IteratorType iter) TRL_NOEXCEPT
+            child_count(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
-                return ptr__->child_count_M_; 
+                return ptr__->child_count_of_M_(ptr__); 
+            }
+
+            /* number of nodes in the subtree of iter, including itself. the root counts every node. see flex_tree_policy::subtree_size. */
+            template <typename IteratorType>
+            static std::size_t
+            subtree_size(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                auto ptr__ = iter.ptr_M_;
+                if (ptr__->is_root_M_())
+                { return static_cast<const flex_tree_header_node__<Policy__>*>(ptr__)->size_M_; }
+                return ptr__->subtree_size_of_M_(ptr__);
+            }
+
+            /*
+             * true if ancestor is a (proper) ancestor of iter, the root is one of every other node. see flex_tree_policy::ancestor_index.
+             * without the index, nodes of different trees are never ancestors of each other. with it, both have to be in the same tree:
+             * labels of different trees may nest as well, so a positive answer is checked by walking up from both in O(depth).
+             * @note exceptions are thrown / behaviour is undefined if:
+             * - `ancestor` and `iter` are in different trees (with ancestor_index only).
+             */
+            template <typename AncestorType, typename IteratorType>
+            static bool
+            is_ancestor(AncestorType ancestor, IteratorType iter) noexcept(!Policy__::exceptions || !Policy__::ancestor_index)
+            {
+                auto ptr__ = iter.ptr_M_;
+                bool res__{ptr__->is_descendant_of_M_(ancestor.ptr_M_)};
+                if constexpr (Policy__::ancestor_index)
+                {
+                    if constexpr (Policy__::exceptions)
+                    { if (res__ && ptr__->find_root_M_() != ancestor.ptr_M_->find_root_M_()) { throw std::invalid_argument("nodes are in different trees"); } }
+                    else
+                    { assert(!res__ || ptr__->find_root_M_() == ancestor.ptr_M_->find_root_M_()); }
+                }
+                return res__;
             }
 
             template <typename IteratorType>
             static bool 
-            is_root(IteratorType iter) TRL_NOEXCEPT
+            is_root(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
                 return ptr__->is_root_M_(); 
@@ -1019,7 +2134,7 @@ namespace trl
 
             template <typename IteratorType>
             static bool 
-            is_first_child(IteratorType iter) TRL_NOEXCEPT
+            is_first_child(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
                 return ptr__->is_first_child_M_(); 
@@ -1027,7 +2142,7 @@ namespace trl
 
             template <typename IteratorType>
             static bool 
-            is_last_child(IteratorType iter) TRL_NOEXCEPT
+            is_last_child(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
                 return ptr__->is_last_child_M_();
@@ -1035,7 +2150,7 @@ namespace trl
 
             template <typename IteratorType>
             static bool 
-            has_next(IteratorType iter) TRL_NOEXCEPT
+            has_next(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
                 return ptr__->has_next_M_();
@@ -1043,7 +2158,7 @@ namespace trl
 
             template <typename IteratorType>
             static bool 
-            has_previous(IteratorType iter) TRL_NOEXCEPT
+            has_previous(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
                 return ptr__->has_prev_M_();
@@ -1051,7 +2166,7 @@ namespace trl
 
             template <typename IteratorType>
             static bool 
-            has_children(IteratorType iter) TRL_NOEXCEPT
+            has_children(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
                 return ptr__->has_children_M_(); 
@@ -1059,43 +2174,58 @@ namespace trl
 
             template <typename IteratorType>
             static bool 
-            is_only_child(IteratorType iter) TRL_NOEXCEPT
+            is_only_child(IteratorType iter) noexcept(!Policy__::exceptions)
             { 
                 auto ptr__ = iter.ptr_M_;
-            #ifndef TRL_NODE_TRAITS_NOEXCEPT
-                if (ptr__->is_root_M_()) { throw std::logic_error("root-node cannot be an only-child"); }
-            #else
-                assert(!ptr__->is_root_M_());
-            #endif
+                if constexpr (Policy__::exceptions)
+                { if (ptr__->is_root_M_()) { throw std::logic_error("root-node cannot be an only-child"); } }
+                else
+                { assert(!ptr__->is_root_M_()); }
                 return ptr__->is_only_child_M_(); 
             }
 
             template <typename IterTp__>
-            using leaf_iter_T_ = flex_tree_leaf_iterator__<std::decay_t<typename IterTp__::value_type>, std::is_const_v<typename IterTp__::value_type>>;
+            using leaf_iter_T_ = flex_tree_leaf_iterator__<std::decay_t<typename IterTp__::value_type>, typename IterTp__::policy_T_, std::is_const_v<typename IterTp__::value_type>>;
 
             template <typename IteratorType>
             static leaf_iter_T_<IteratorType>
-            lbegin(IteratorType iter) TRL_NOEXCEPT
+            lbegin(IteratorType iter) noexcept(!Policy__::exceptions)
             { return leaf_iter_T_<IteratorType>(first_child(iter).ptr_M_); }
 
             template <typename IteratorType>
             static leaf_iter_T_<IteratorType>
-            lend(IteratorType iter) TRL_NOEXCEPT
+            lend(IteratorType iter) noexcept(!Policy__::exceptions)
             { return leaf_iter_T_<IteratorType>(iter.ptr_M_); }
 
         };
 
+        /**
+         * allocators that can drop all of their allocations of one size at once (e.g. trl::pool_allocator).
+         * chunk_size() is the size of the chunks objects of the value-type are pooled in,
+         * pooled_objects() reports how many objects are currently allocated in chunks of that size
+         * and release() frees all of those without destroying them. objects of other sizes are not affected.
+         */
+        template <typename Alloc__>
+        concept arena_allocator__ = requires (Alloc__& alloc__, const Alloc__& c_alloc__)
+        {
+            alloc__.release();
+            { c_alloc__.pooled_objects() } -> std::convertible_to<std::size_t>;
+            { c_alloc__.chunk_size() } -> std::convertible_to<std::size_t>;
+        };
+
         /**
          * contains all allocation/deallocation logic for nodes in the flex-tree 
          * (with the exception of the node-initializer, see that for more info).
          */
-        template <typename ValTp__, typename Alloc__>
+        template <typename ValTp__, typename Alloc__, typename Policy__>
         struct flex_tree_base__
         {
             using alloc_T_ = Alloc__;
-            using node_T_ = flex_tree_node__<ValTp__>;
-            using base_ptr_T_ = flex_tree_node_base__*;
-            using c_base_ptr_T_ = const flex_tree_node_base__*;
+            using node_T_ = flex_tree_node__<ValTp__, Policy__>;
+            using header_T_ = flex_tree_header_node__<Policy__>;
+            using node_base_T_ = flex_tree_node_base__<Policy__>;
+            using base_ptr_T_ = flex_tree_node_base__<Policy__>*;
+            using c_base_ptr_T_ = const flex_tree_node_base__<Policy__>*;
             using node_ptr_T_ = node_T_*;
             using c_node_ptr_T_ = const node_T_*;
             using node_alloc_T_ = typename std::allocator_traits<alloc_T_>::template rebind_alloc<node_T_>;
@@ -1103,46 +2233,48 @@ namespace trl
             struct flex_tree_impl__
                 : public node_alloc_T_
             {
-                flex_tree_header_node__* header_M_{nullptr}; /* heap-allocated because of easy move-semantics. overhead? */
-
-                void
-                make_header_M_() /* no allocator used here since the head does not store a value */
-                { this->header_M_ = new flex_tree_header_node__(); }
-
-                void discard_header_M_()
-                { delete this->header_M_; }
+                header_T_ header_M_; /* embedded, empty trees and moves do not allocate */
 
                 flex_tree_impl__(const node_alloc_T_& node_alloc_)
                     : node_alloc_T_(node_alloc_) 
-                { this->make_header_M_(); }
-
-                flex_tree_impl__(const flex_tree_impl__& o__)
-                { this->make_header_M_(); }
+                { }
 
-                flex_tree_impl__& operator=(const flex_tree_impl__& o__)
-                { if (!this->header_M_) { this->make_header_M_(); } }
+                flex_tree_impl__(const flex_tree_impl__&) = delete;
+                flex_tree_impl__& operator=(const flex_tree_impl__&) = delete;
 
-                flex_tree_impl__(flex_tree_impl__&& o__)
-                { std::swap(this->header_M_, o__.header_M_); }
+                /* the allocator travels with the nodes, stateful allocators (e.g. trl::pool_allocator) must free what they allocated */
+                flex_tree_impl__(flex_tree_impl__&& o__) noexcept
+                    : node_alloc_T_(o__.get_node_alloc_M_())
+                { this->header_M_.take_children_M_(o__.header_M_); }
 
-                flex_tree_impl__& operator=(flex_tree_impl__&& o__)
-                { std::swap(this->header_M_, o__.header_M_); return *this; }
+                flex_tree_impl__& operator=(flex_tree_impl__&& o__) noexcept
+                { this->swap_M_(o__); return *this; }
 
-                ~flex_tree_impl__()
-                { this->discard_header_M_(); }
+                void
+                swap_M_(flex_tree_impl__& o__) noexcept
+                {
+                    using std::swap;
+                    swap(this->get_node_alloc_M_(), o__.get_node_alloc_M_());
+                    this->header_M_.swap_M_(o__.header_M_);
+                }
 
                 template <typename... Args__>
                 node_ptr_T_
                 get_node_M_(Args__&&... args__)
                 {
                     node_ptr_T_ new_ = std::allocator_traits<node_alloc_T_>::allocate(this->get_node_alloc_M_(), 1);
-                    std::allocator_traits<node_alloc_T_>::construct(this->get_node_alloc_M_(), new_, std::forward<Args__>(args__)...);
+                    try
+                    { std::allocator_traits<node_alloc_T_>::construct(this->get_node_alloc_M_(), new_, std::forward<Args__>(args__)...); }
+                    catch (...)
+                    { std::allocator_traits<node_alloc_T_>::deallocate(this->get_node_alloc_M_(), new_, 1); throw; }
+                    ++this->header_M_.modifications_M_;
                     return new_;
                 }
 
                 void
                 put_node_M_(node_ptr_T_ node__)
                 {
+                    ++this->header_M_.modifications_M_;
                     std::allocator_traits<node_alloc_T_>::destroy(this->get_node_alloc_M_(), node__);
                     std::allocator_traits<node_alloc_T_>::deallocate(this->get_node_alloc_M_(), node__, 1);
                 }
@@ -1161,51 +2293,50 @@ namespace trl
 
             };
 
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-
             /**
-             * recursively update depth-member variable of node__ and all of it's descendants.
-             * maybe review semantics of this method to only change depth of child-nodes ?
+             * update the depth-member variable of all descendants of node__, 
+             * based on the (already correct) depth of node__ itself.
+             * OK to be called on nodes without child-nodes. only for policies with depth_count.
              */
             std::size_t
-            update_depth_M_(base_ptr_T_ node__, std::size_t depth__)
+            update_depth_M_(base_ptr_T_ node__)
             {
-                assert(node__->has_children_M_());
+                if (!node__->has_children_M_())
+                { return 0ull; }
 
-                node__->depth_count_M_ = depth__;
                 base_ptr_T_ iter__ = node__->first_child_M_;
                 std::size_t nodes_affected__{0ull};
-            #ifdef TRL_FLEX_TREE_NO_RECURSION
-                while (true)
+                if constexpr (Policy__::no_recursion)
                 {
-                    iter__->depth_count_M_ = iter__->parent_M_->depth_count_M_ + 1; 
-                    ++nodes_affected__;
-
-                    if (iter__->has_children_M_()) 
-                    { iter__ = iter__->first_child_M_; continue; }
-                    while (iter__->is_last_child_M_() && !iter__->is_root_M_()) 
-                    { iter__ = iter__->parent_M_;  }
-                    if (iter__ == node__) { break; } /* intercept here if depth-first-search is back at start node*/
-                    iter__ = iter__->next_M_;
+                    while (true)
+                    {
+                        iter__->depth_count_M_ = iter__->parent_M_->depth_count_M_ + 1; 
+                        ++nodes_affected__;
+
+                        if (iter__->has_children_M_()) 
+                        { iter__ = iter__->first_child_M_; continue; }
+                        while (iter__->is_last_child_M_()) 
+                        {
+                            iter__ = iter__->parent_M_;
+                            if (iter__ == node__) { return nodes_affected__; } /* intercept here if depth-first-search is back at start node */
+                        }
+                        iter__ = iter__->next_M_;
+                    }
                 }
-            #else
-                while (true)
+                else
                 {
-                    if (iter__->has_children_M_())
-                    { nodes_affected__ += update_depth_M_(iter__, depth__ + 1); }
-                    else
-                    { iter__->depth_count_M_ = depth__ + 1; }
-                    ++nodes_affected__;
-                    if (!iter__->has_next_M_())
-                    { break; }
-                    iter__ = iter__->next_M_;
+                    while (true)
+                    {
+                        iter__->depth_count_M_ = node__->depth_count_M_ + 1;
+                        nodes_affected__ += update_depth_M_(iter__) + 1;
+                        if (iter__->is_last_child_M_()) /* next_M_ may already point to a cousin */
+                        { break; }
+                        iter__ = iter__->next_M_;
+                    }
                 }
-            #endif
                 return nodes_affected__;
             }
 
-        #endif
-
             /**
              * OK to be called on any value-node or on the header as the header will never be a child-node of any other node.
              * expects node__ to definitely have child-nodes.
@@ -1218,91 +2349,406 @@ namespace trl
                 c_base_ptr_T_ iter__{node__->first_child_M_}; /* possibly iter__ == node__*/
                 std::size_t nodes_affected__{0ull};
 
-            #ifdef TRL_FLEX_TREE_NO_RECURSION
-                /* traverse two trees depth-first at once and copy the structure from one to another */
-                base_ptr_T_ copy_iter__{new_parent__};
-                while (true)
+                if constexpr (Policy__::no_recursion)
                 {
-                    node_ptr_T_ copy__ = this->impl_M_.get_node_M_(static_cast<c_node_ptr_T_>(iter__)->value_M_);
-                    copy__->hook_as_last_child_M_(copy_iter__);
-                    ++nodes_affected__;
-
-                    if (iter__->has_children_M_()) 
-                    { iter__ = iter__->first_child_M_; copy_iter__ = copy_iter__->first_child_M_; continue; }
-                    while (iter__->is_last_child_M_() && !iter__->is_root_M_()) 
-                    { iter__ = iter__->parent_M_; copy_iter__ = copy_iter__->parent_M_;  }
-                    if (iter__ == node__) { break; } /* intercept here if depth-first-search is back at start node*/
-                    iter__ = iter__->next_M_; copy_iter__ = copy_iter__->next_M_;
+                    /* traverse the source depth-first and keep track of the copy of iter__'s parent */
+                    /* and of the last child of copy_parent__, so appending does not depend on last-child-links */
+                    base_ptr_T_ copy_parent__{new_parent__};
+                    base_ptr_T_ copy_last__{new_parent__->has_children_M_() ? node_base_T_::last_child_of_M_(new_parent__) : nullptr};
+                    while (true)
+                    {
+                        node_ptr_T_ copy__ = this->impl_M_.get_node_M_(static_cast<c_node_ptr_T_>(iter__)->value_M_);
+                        if constexpr (Policy__::subtree_size)
+                        { copy__->subtree_size_M_ = iter__->subtree_size_M_; }
+                        if (copy_last__) { copy__->hook_behind_last_child_M_(copy_last__); }
+                        else { copy__->hook_as_last_child_M_(copy_parent__); }
+                        copy_last__ = copy__;
+                        ++nodes_affected__;
+
+                        if (iter__->has_children_M_()) 
+                        { iter__ = iter__->first_child_M_; copy_parent__ = copy__; copy_last__ = nullptr; continue; }
+                        while (iter__->is_last_child_M_()) 
+                        {
+                            iter__ = iter__->parent_M_;
+                            if (iter__ == node__) { return nodes_affected__; } /* intercept here if depth-first-search is back at start node */
+                            copy_last__ = copy_parent__;
+                            copy_parent__ = copy_parent__->parent_M_;
+                        }
+                        iter__ = iter__->next_M_;
+                    }
                 }
-            #else
-                while (true)
+                else
                 {
-                    node_ptr_T_ copy__ = this->impl_M_.get_node_M_(static_cast<c_node_ptr_T_>(iter__)->value_M_);
-                    copy__->hook_as_last_child_M_(new_parent__);
+                    base_ptr_T_ copy_last__{new_parent__->has_children_M_() ? node_base_T_::last_child_of_M_(new_parent__) : nullptr};
+                    while (true)
+                    {
+                        node_ptr_T_ copy__ = this->impl_M_.get_node_M_(static_cast<c_node_ptr_T_>(iter__)->value_M_);
+                        if constexpr (Policy__::subtree_size)
+                        { copy__->subtree_size_M_ = iter__->subtree_size_M_; }
+                        if (copy_last__) { copy__->hook_behind_last_child_M_(copy_last__); }
+                        else { copy__->hook_as_last_child_M_(new_parent__); }
+                        copy_last__ = copy__;
 
-                    if (iter__->has_children_M_())
-                    { nodes_affected__ += copy_children_M_(copy__, iter__); }
+                        if (iter__->has_children_M_())
+                        { nodes_affected__ += copy_children_M_(copy__, iter__); }
 
-                    ++nodes_affected__;
+                        ++nodes_affected__;
 
-                    if (!iter__->has_next_M_())
-                    { break; }
+                        if (iter__->is_last_child_M_()) /* next_M_ may already point to a cousin */
+                        { break; }
 
-                    iter__ = iter__->next_M_;
+                        iter__ = iter__->next_M_;
+                    }
                 }
-            #endif
                 return nodes_affected__;
             }
 
             /**
              * OK to be called on any value-node or on the header as the header will never be a child-node of any other node.
              * expects node__ to definitely have child-nodes.
+             * @details
+             * the descendants of node__ occupy a contiguous range on every depth-layer below it, so they are
+             * released layer by layer: every range is cut out of it's depth-layer once and it's nodes are then
+             * put back without unhooking them one by one. needs neither recursion nor per-node relinking.
+             * without layer-links the descendants are released in post-order instead.
              */
             std::size_t 
             erase_children_M_(base_ptr_T_ node__)
             {
                 assert(node__->has_children_M_());
 
+                if constexpr (!Policy__::layer_links)
+                { return this->erase_children_post_order_M_(node__); }
+                else
+                {
+                    base_ptr_T_ first__{node__};
+                    base_ptr_T_ last__{node__};
+                    std::size_t nodes_affected__{0ull};
+                    bool has_layer__{node__->next_layer_M_(first__, last__)};
+
+                    while (has_layer__)
+                    {
+                        node__->unhook_layer_range_M_(first__, last__);
+                        base_ptr_T_ iter__{first__};
+                        base_ptr_T_ end__{last__};
+                        has_layer__ = node__->next_layer_M_(first__, last__); /* read the layer below before releasing this one */
+                        while (true)
+                        {
+                            base_ptr_T_ next__{iter__->next_M_};
+                            this->impl_M_.put_node_M_(static_cast<node_ptr_T_>(iter__)); /* static_cast should not fail as it is never called on root */
+                            ++nodes_affected__;
+                            if (iter__ == end__) { break; }
+                            iter__ = next__;
+                        }
+                    }
+
+                    node__->clear_children_M_();
+                    return nodes_affected__;
+                }
+            }
+
+            /**
+             * releases the descendants of node__ in post-order, so every node is put back after it's children
+             * and the links that are still needed are never read from a released node.
+             * expects node__ to definitely have child-nodes.
+             */
+            std::size_t
+            erase_children_post_order_M_(base_ptr_T_ node__)
+            {
                 base_ptr_T_ iter__{node__->first_child_M_};
                 std::size_t nodes_affected__{0ull};
-
-            #ifdef TRL_FLEX_TREE_NO_RECURSION
-                base_ptr_T_ iter_before__{iter__};   
                 while (true)
                 {
-                    /* save current node */
-                    iter_before__ = iter__;
-                    /* advance, and only unhook and delete afterwards (if node has no children) */
-                    if (iter__->has_children_M_()) 
-                    { iter__ = iter__->first_child_M_; continue; }
-                    while (iter__->is_last_child_M_() && !iter__->is_root_M_()) 
-                    { iter__ = iter__->parent_M_;  }
-                    if (iter__ == node__) { break; } /* intercept here if depth-first-search is back at start node*/
-                    iter__ = iter__->next_M_;
+                    while (iter__->has_children_M_())
+                    { iter__ = iter__->first_child_M_; }
+                    while (true)
+                    {
+                        base_ptr_T_ parent__{iter__->parent_M_};
+                        base_ptr_T_ next__{iter__->is_last_child_M_() ? nullptr : iter__->next_M_};
+                        this->impl_M_.put_node_M_(static_cast<node_ptr_T_>(iter__)); /* static_cast should not fail as it is never called on root */
+                        ++nodes_affected__;
+                        if (next__) 
+                        { iter__ = next__; break; }
+                        if (parent__ == node__)
+                        {
+                            node__->clear_children_M_();
+                            return nodes_affected__;
+                        }
+                        iter__ = parent__; /* all of it's children are released, so it is next in post-order */
+                    }
+                }
+            }
+
+            /**
+             * erases every node of the tree. if the nodes need no destruction and the tree is the only 
+             * user of the chunks it's arena-allocator pools the nodes in, they are all released at once instead.
+             */
+            void
+            erase_all_M_()
+            {
+                header_T_* header__{&this->impl_M_.header_M_};
+                if constexpr (std::is_trivially_destructible_v<node_T_> && arena_allocator__<node_alloc_T_>)
+                {
+                    node_alloc_T_& alloc__{this->impl_M_.get_node_alloc_M_()};
+                    /* every node of the tree is pooled in chunks of this size, so if there are no more of them, 
+                       there are no other objects in them (e.g. of another tree or container sharing the pool) */
+                    if (alloc__.chunk_size() >= sizeof(node_T_) && alloc__.pooled_objects() == header__->size_M_)
+                    {
+                        ++header__->modifications_M_;
+                        alloc__.release();
+                        header__->clear_children_M_();
+                        header__->forget_layers_M_();
+                        header__->size_M_ = 0ull;
+                        return;
+                    }
+                }
+                header__->size_M_ -= this->erase_children_M_(header__);
+                header__->forget_layers_M_();
+            }
 
-                    iter_before__->unhook_M_();
-                    this->impl_M_.put_node_M_(static_cast<node_ptr_T_>(iter_before__));
+            /**
+             * builds the nodes described by an initializer-list below the header of an empty tree.
+             * nodes are allocated in pre-order and only linked to their parents and siblings at first,
+             * one pass over the new depth-layers then joins the sibling-groups on every layer (if the policy wants layer-links).
+             * if a value-constructor throws, the nodes built so far are released and the tree stays empty.
+             */
+            template <typename Init__>
+            void
+            from_initializer_list_M_(std::initializer_list<Init__> ilist__)
+            {
+                ++this->impl_M_.header_M_.modifications_M_;
+                assert(!this->impl_M_.header_M_.has_children_M_());
+                if (!ilist__.size()) { return; }
+                try
+                { this->impl_M_.header_M_.size_M_ = this->build_initializer_M_(&this->impl_M_.header_M_, ilist__); }
+                catch (...)
+                { this->erase_unwoven_M_(); throw; }
+                this->weave_layers_M_();
+                if constexpr (Policy__::ancestor_index)
+                { this->impl_M_.header_M_.index_tree_M_(this->impl_M_.header_M_.size_M_); }
+            }
 
-                    ++nodes_affected__;
+            /**
+             * builds the nodes of a pre-order sequence below the header of an empty tree.
+             * value_at__(i) yields the value of the i-th node, depth_at__(i) it's depth (1 for top-level nodes),
+             * so every depth is at most one deeper than the one before. like from_initializer_list_M_,
+             * nodes are only linked to their parents and siblings at first and the depth-layers are joined afterwards,
+             * and the tree stays empty if a value-constructor throws.
+             */
+            template <typename ValueAt__, typename DepthAt__>
+            void
+            from_pre_order_M_(std::size_t count__, ValueAt__&& value_at__, DepthAt__&& depth_at__)
+            {
+                ++this->impl_M_.header_M_.modifications_M_;
+                assert(!this->impl_M_.header_M_.has_children_M_());
+                /* path__[d] is the most recent node on depth d, the previous sibling of the next node on depth d */
+                std::vector<base_ptr_T_> path__{&this->impl_M_.header_M_};
+                /* starts__[d] is the index of path__[d], so it's subtree ends where the path leaves it */
+                std::vector<std::size_t> starts__{0ull};
+                auto leave_path__ = [&path__, &starts__](std::size_t depth__, std::size_t end__)
+                {
+                    if constexpr (Policy__::subtree_size)
+                    {
+                        for (std::size_t d__{depth__}; d__ < path__.size(); ++d__)
+                        { path__[d__]->subtree_size_M_ = end__ - starts__[d__]; }
+                        starts__.resize(depth__);
+                    }
+                };
+                try
+                {
+                    for (std::size_t i__{0ull}; i__ < count__; ++i__)
+                    {
+                        std::size_t depth__{depth_at__(i__)};
+                        assert(depth__ && depth__ <= path__.size());
+                        base_ptr_T_ prev__{depth__ < path__.size() ? path__[depth__] : nullptr};
+                        leave_path__(depth__, i__);
+                        path__.resize(depth__);
+                        base_ptr_T_ parent__{path__.back()};
+                        base_ptr_T_ new__{this->impl_M_.get_node_M_(value_at__(i__))};
+                        new__->parent_M_ = parent__;
+                        if constexpr (Policy__::depth_count)
+                        { new__->depth_count_M_ = depth__; }
+                        if (prev__) { prev__->entangle_M_(new__); }
+                        else { parent__->first_child_M_ = new__; }
+                        parent__->last_child_M_ = new__;
+                        ++parent__->child_count_M_;
+                        path__.push_back(new__);
+                        if constexpr (Policy__::subtree_size)
+                        { starts__.push_back(i__); }
+                    }
                 }
-            #else
-                bool break__ = true;
-                base_ptr_T_ iter_before__{iter__};   
-                while (break__)
-                { 
-                    if (iter__->has_children_M_())
-                    { nodes_affected__ += erase_children_M_(iter__); }
+                catch (...)
+                { this->erase_unwoven_M_(); throw; }
+                leave_path__(1ull, count__);
+                this->impl_M_.header_M_.size_M_ = count__;
+                this->weave_layers_M_();
+                if constexpr (Policy__::ancestor_index)
+                { this->impl_M_.header_M_.index_tree_M_(count__); }
+            }
 
-                    iter_before__ = iter__; // save node before deletion
-                    iter__ = iter__->next_M_;
+            /**
+             * releases the nodes of a tree that is still being built, before it's depth-layers were joined.
+             * every child-list is complete up to the last node that was built, so they are erased sibling by sibling.
+             */
+            void
+            erase_unwoven_M_() noexcept
+            {
+                if (this->impl_M_.header_M_.has_children_M_())
+                { this->erase_children_post_order_M_(&this->impl_M_.header_M_); }
+                this->impl_M_.header_M_.forget_layers_M_();
+                this->impl_M_.header_M_.size_M_ = 0ull;
+            }
+
+            /**
+             * joins the last child of every sibling-group with the first child of the next one on the same depth-layer,
+             * for trees that were built with sibling-links only, and records the deepest layer in the header on the way.
+             * does nothing if the policy does not want layer-links.
+             */
+            void
+            weave_layers_M_()
+            {
+                if constexpr (Policy__::layer_links)
+                {
+                    base_ptr_T_ layer__{&this->impl_M_.header_M_};
+                    while (true)
+                    {
+                        base_ptr_T_ next_layer__{nullptr};
+                        base_ptr_T_ prev_last__{nullptr};
+                        for (base_ptr_T_ iter__{layer__}; ; iter__ = iter__->next_M_)
+                        {
+                            if (iter__->has_children_M_())
+                            {
+                                if (prev_last__) { prev_last__->entangle_M_(iter__->first_child_M_); }
+                                else { next_layer__ = iter__->first_child_M_; }
+                                prev_last__ = iter__->last_child_M_;
+                            }
+                            if (!iter__->has_next_M_()) { break; }
+                        }
+                        if (!next_layer__) { break; }
+                        this->impl_M_.header_M_.deepest_first_M_ = next_layer__;
+                        this->impl_M_.header_M_.deepest_last_M_ = prev_last__;
+                        ++this->impl_M_.header_M_.height_M_;
+                        layer__ = next_layer__;
+                    }
+                }
+            }
+
+            /**
+             * moves every node into a new allocation, in the order of order__ (which lists every node of the tree once).
+             * allocators with reserve_sequential() (trl::pool_allocator) hand them out from one contiguous range in that order,
+             * so nodes that are visited one after another also lie next to each other in memory.
+             * all memory is allocated before any value is touched and values are only moved if that cannot throw (copied otherwise),
+             * so an exception leaves the tree unchanged. links are translated through the next_M_-field of every old node,
+             * which points to it's replacement once all links have been copied.
+             */
+            void
+            relocate_nodes_M_(const std::vector<node_ptr_T_>& order__)
+            {
+                using traits__ = std::allocator_traits<node_alloc_T_>;
+                node_alloc_T_& alloc__{this->impl_M_.get_node_alloc_M_()};
+                std::vector<node_ptr_T_> new__;
+                new__.reserve(order__.size());
+                if constexpr (requires { alloc__.reserve_sequential(order__.size()); })
+                { alloc__.reserve_sequential(order__.size()); }
+                std::size_t constructed__{0ull};
+                try
+                {
+                    for (std::size_t i__{0ull}; i__ < order__.size(); ++i__)
+                    { new__.push_back(traits__::allocate(alloc__, 1)); }
+                    for (; constructed__ < order__.size(); ++constructed__)
+                    { traits__::construct(alloc__, new__[constructed__], std::move_if_noexcept(order__[constructed__]->value_M_)); }
+                }
+                catch (...)
+                {
+                    if constexpr (requires { alloc__.reserve_sequential(0ull); })
+                    { alloc__.reserve_sequential(0ull); }
+                    for (std::size_t i__{0ull}; i__ < new__.size(); ++i__)
+                    {
+                        if (i__ < constructed__) { traits__::destroy(alloc__, new__[i__]); }
+                        traits__::deallocate(alloc__, new__[i__], 1);
+                    }
+                    throw;
+                }
+
+                for (std::size_t i__{0ull}; i__ < order__.size(); ++i__)
+                {
+                    node_ptr_T_ old_node__{order__[i__]}, new_node__{new__[i__]};
+                    new_node__->parent_M_ = old_node__->parent_M_;
+                    new_node__->first_child_M_ = old_node__->first_child_M_;
+                    new_node__->next_M_ = old_node__->next_M_;
+                    if constexpr (Policy__::last_child_link)
+                    { new_node__->last_child_M_ = old_node__->last_child_M_; }
+                    if constexpr (Policy__::prev_link)
+                    { new_node__->prev_M_ = old_node__->prev_M_; }
+                    if constexpr (Policy__::child_count)
+                    { new_node__->child_count_M_ = old_node__->child_count_M_; }
+                    if constexpr (Policy__::depth_count)
+                    { new_node__->depth_count_M_ = old_node__->depth_count_M_; }
+                    if constexpr (Policy__::subtree_size)
+                    { new_node__->subtree_size_M_ = old_node__->subtree_size_M_; }
+                    if constexpr (Policy__::ancestor_index)
+                    {
+                        new_node__->enter_label_M_ = old_node__->enter_label_M_;
+                        new_node__->exit_label_M_ = old_node__->exit_label_M_;
+                    }
+                }
+                for (std::size_t i__{0ull}; i__ < order__.size(); ++i__)
+                { order__[i__]->next_M_ = new__[i__]; }
 
-                    break__ = iter__->has_next_M_();
+                base_ptr_T_ header__{&this->impl_M_.header_M_};
+                /* links to a node itself (no link) are translated to the new node like any other link */
+                auto translate__ = [header__](base_ptr_T_ link__) { return link__ == header__ ? header__ : link__->next_M_; };
+                auto relink__ = [&translate__](base_ptr_T_ node__)
+                {
+                    node__->parent_M_ = translate__(node__->parent_M_);
+                    node__->first_child_M_ = translate__(node__->first_child_M_);
+                    node__->next_M_ = translate__(node__->next_M_);
+                    if constexpr (Policy__::last_child_link)
+                    { node__->last_child_M_ = translate__(node__->last_child_M_); }
+                    if constexpr (Policy__::prev_link)
+                    { node__->prev_M_ = translate__(node__->prev_M_); }
+                };
+                relink__(header__);
+                if constexpr (Policy__::layer_links)
+                {
+                    this->impl_M_.header_M_.deepest_first_M_ = translate__(this->impl_M_.header_M_.deepest_first_M_);
+                    this->impl_M_.header_M_.deepest_last_M_ = translate__(this->impl_M_.header_M_.deepest_last_M_);
+                }
+                for (node_ptr_T_ node__ : new__)
+                { relink__(node__); }
+                for (node_ptr_T_ node__ : order__)
+                { this->impl_M_.put_node_M_(node__); }
+            }
 
-                    iter_before__->unhook_M_();
-                    this->impl_M_.put_node_M_(static_cast<node_ptr_T_>(iter_before__)); /* static_cast should not fail as it is never called on root */
-                    ++nodes_affected__;
+            /**
+             * allocates the children described by ilist__, links them as the only children of parent__.
+             * every node is linked as soon as it is built, so the nodes built before a throwing constructor can be erased.
+             * @return the number of allocated nodes.
+             */
+            template <typename Init__>
+            std::size_t
+            build_initializer_M_(base_ptr_T_ parent__, std::initializer_list<Init__> ilist__)
+            {
+                std::size_t nodes_affected__{0ull};
+                base_ptr_T_ prev__{nullptr};
+                for (const Init__& init__ : ilist__)
+                {
+                    base_ptr_T_ new__{init__.make_node_M_(this->impl_M_.get_node_alloc_M_())};
+                    new__->parent_M_ = parent__;
+                    if constexpr (Policy__::depth_count)
+                    { new__->depth_count_M_ = parent__->depth_count_M_ + 1; }
+                    if (prev__) { prev__->entangle_M_(new__); }
+                    else { parent__->first_child_M_ = new__; }
+                    parent__->last_child_M_ = new__;
+                    ++parent__->child_count_M_;
+                    prev__ = new__;
+                    std::size_t subtree__{1ull};
+                    if (init__.children_M_.size())
+                    { subtree__ += this->build_initializer_M_(new__, init__.children_M_); }
+                    if constexpr (Policy__::subtree_size)
+                    { new__->subtree_size_M_ = subtree__; }
+                    nodes_affected__ += subtree__;
                 }
-            #endif
                 return nodes_affected__;
             }
 
@@ -1314,57 +2760,70 @@ namespace trl
         };
     }
 
+    /* contiguous counterpart, see flat_flex_tree.hpp */
+    template <typename Type, typename Allocator, typename Policy>
+    class flat_flex_tree;
+
     /**
      * @brief C++ STL-like implementation of a flexible arbitrary-ary tree-data-structure.
      * @tparam Type the type that every node should contain.
      * @tparam Allocator an allocator type.
+     * @tparam Policy compile-time configuration of the tree, see trl::flex_tree_policy.
      */
-    template <typename Type, typename Allocator = std::allocator<Type>>
+    template <typename Type, typename Allocator = std::allocator<Type>, typename Policy = flex_tree_policy>
     class flex_tree
-        : protected detail__::flex_tree_base__<Type, Allocator>
+        : protected detail__::flex_tree_base__<Type, Allocator, Policy>
     {
     public:
 
-        static constexpr traversal default_traversal = TRL_FLEX_TREE_DEFAULT_TRAVERSAL;
+        static constexpr traversal default_traversal = Policy::default_traversal;
 
         using value_type = Type;
         using allocator_type = Allocator;
-        using initializer_type = detail__::flex_tree_node_initializer__<Allocator>;
+        using policy_type = Policy;
+        /**
+         * element of the braced initializer-lists accepted by the constructor and assignment. it only refers to the values
+         * and children written in the braces, which live until the end of the full-expression:
+         * pass the braces to the tree directly, an initializer-list of it that is stored in a variable refers to destroyed temporaries.
+         */
+        using initializer_type = detail__::flex_tree_node_initializer__<Allocator, Policy>;
         
 
         template <traversal Traversal = default_traversal>
-        using iterator = detail__::flex_tree_iterator__<Traversal, value_type, false>;
+        using iterator = detail__::flex_tree_iterator__<Traversal, value_type, Policy, false>;
 
         template <traversal Traversal = default_traversal>
-        using const_iterator = detail__::flex_tree_iterator__<Traversal, value_type, true>;
+        using const_iterator = detail__::flex_tree_iterator__<Traversal, value_type, Policy, true>;
     
-    #ifndef TRL_FLEX_TREE_STL_REVERSE_ITER
-        template <traversal Traversal = default_traversal>
-        using reverse_iterator = detail__::flex_tree_reverse_iterator__<Traversal, value_type, false>;
-
-        template <traversal Traversal = default_traversal>
-        using const_reverse_iterator = detail__::flex_tree_reverse_iterator__<Traversal, value_type, true>;
-    #else
         template <traversal Traversal = default_traversal>
-        using reverse_iterator = std::reverse_iterator<iterator<Traversal>>;
+        using reverse_iterator = std::conditional_t<Policy::stl_reverse_iterator, 
+            std::reverse_iterator<iterator<Traversal>>, 
+            detail__::flex_tree_reverse_iterator__<Traversal, value_type, Policy, false>>;
 
         template <traversal Traversal = default_traversal>
-        using const_reverse_iterator = std::reverse_iterator<const_iterator<Traversal>>;
-    #endif
+        using const_reverse_iterator = std::conditional_t<Policy::stl_reverse_iterator, 
+            std::reverse_iterator<const_iterator<Traversal>>, 
+            detail__::flex_tree_reverse_iterator__<Traversal, value_type, Policy, true>>;
         
-        using leaf_iterator = detail__::flex_tree_leaf_iterator__<value_type, false>;
-        using const_leaf_iterator = detail__::flex_tree_leaf_iterator__<value_type, true>;
+        using leaf_iterator = detail__::flex_tree_leaf_iterator__<value_type, Policy, false>;
+        using const_leaf_iterator = detail__::flex_tree_leaf_iterator__<value_type, Policy, true>;
 
-        using node_traits = detail__::flex_tree_node_traits__;
+        using node_traits = detail__::flex_tree_node_traits__<Policy>;
 
     protected:
 
-        using node_T_ = detail__::flex_tree_node__<value_type>;
+        using node_T_ = detail__::flex_tree_node__<value_type, Policy>;
         using node_ptr_T_ = node_T_*;
-        using base_ptr_T_ = detail__::flex_tree_node_base__*;
-        using node_initializer_T_ = detail__::flex_tree_node_initializer__<allocator_type>;
+        using base_ptr_T_ = detail__::flex_tree_node_base__<Policy>*;
+        using c_base_ptr_T_ = const detail__::flex_tree_node_base__<Policy>*;
+        using node_base_T_ = detail__::flex_tree_node_base__<Policy>;
+        using node_initializer_T_ = detail__::flex_tree_node_initializer__<allocator_type, Policy>;
         using node_alloc_T_ = typename std::allocator_traits<allocator_type>::template rebind_alloc<node_T_>;
 
+        /* converts from and to flex_tree through the nodes directly */
+        template <typename, typename, typename>
+        friend class flat_flex_tree;
+
     public:
 
         /**
@@ -1376,31 +2835,23 @@ namespace trl
          * @brief 
          * initializes the tree using a recursively constructed initializer-list.
          * @details
-         * this constructor is only supported for default-constructible allocator-types such as std::allocator.
-         * because the initializer-list constructs the nodes recursively the tree is basically built up from the inside and before this constructor is called.
-         * this requires node-allocation and i found no way to do this using the allocator contained in the tree itself (as it doesn't exist at the time the inner nodes are constructed).
+         * the initializer-list only refers to the values, every node is allocated through `allocator`.
+         * if a value-constructor throws, the nodes constructed so far are destroyed and the exception is rethrown.
          * @param ilist the initializer-list containing the values and node-hierarchy. see examples for a reference-usage.
          */
-        flex_tree(std::initializer_list<node_initializer_T_> ilist, const allocator_type& allocator = allocator_type()) noexcept
+        flex_tree(std::initializer_list<node_initializer_T_> ilist, const allocator_type& allocator = allocator_type())
             : flex_tree(allocator)
-        {
-            this->impl_M_.header_M_->from_initializer_list_M_(ilist);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(this->impl_M_.header_M_, 0);
-        #endif
-        }
+        { this->from_initializer_list_M_(ilist); }
 
         /**
-         * @brief initializer-list assignment.
+         * @brief initializer-list assignment. leaves the tree empty if a value-constructor throws.
          */
         flex_tree& 
-        operator=(std::initializer_list<node_initializer_T_> ilist) noexcept 
+        operator=(std::initializer_list<node_initializer_T_> ilist) 
         { 
             this->clear();
-            this->impl_M_.header_M_->from_initializer_list_M_(ilist);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(this->impl_M_.header_M_, 0);
-        #endif
+            this->from_initializer_list_M_(ilist);
+            return *this;
         }
 
         /**
@@ -1411,49 +2862,56 @@ namespace trl
          * - `where` is an `end()`-iterator.
          */
         template <traversal Traversal>
-        explicit flex_tree(const_iterator<Traversal> where, const allocator_type& allocator = allocator_type()) TRL_NOEXCEPT
+        explicit flex_tree(const_iterator<Traversal> where, const allocator_type& allocator = allocator_type()) noexcept(!Policy::exceptions)
             : flex_tree(allocator)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!where.node_ptr_M_()->is_root_M_()); }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(*where);
+            std::size_t copied__{1ull};
             if (where.node_ptr_M_()->has_children_M_())
-            { this->copy_children_M_(new__, where); }
-            new__->hook_as_last_child_M_(this->impl_M_.header_M_);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(this->impl_M_.header_M_, 0);
-        #endif
+            { copied__ += this->copy_children_M_(new__, where); }
+            if constexpr (Policy::subtree_size)
+            { new__->subtree_size_M_ = copied__; }
+            new__->hook_as_last_child_M_(&this->impl_M_.header_M_);
+            this->impl_M_.header_M_.hooked_M_(new__, copied__);
+            this->impl_M_.header_M_.size_M_ = copied__;
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(&this->impl_M_.header_M_); }
         }
 
         /**
          * @brief subtree assignment.
          */
         template <traversal Traversal>
-        flex_tree& operator=(const_iterator<Traversal> where) TRL_NOEXCEPT
+        flex_tree& operator=(const_iterator<Traversal> where) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!where.node_ptr_M_()->is_root_M_()); }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(*where);
+            std::size_t copied__{1ull};
             if (where.node_ptr_M_()->has_children_M_())
-            { this->copy_children_M_(new__, where); }
+            { copied__ += this->copy_children_M_(new__, where); }
+            if constexpr (Policy::subtree_size)
+            { new__->subtree_size_M_ = copied__; }
             this->clear();
-            new__->hook_as_last_child_M_(this->impl_M_.header_M_);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(this->impl_M_.header_M_, 0);
-        #endif
+            new__->hook_as_last_child_M_(&this->impl_M_.header_M_);
+            this->impl_M_.header_M_.hooked_M_(new__, copied__);
+            this->impl_M_.header_M_.size_M_ = copied__;
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(&this->impl_M_.header_M_); }
+            return *this;
         }
 
         /**
          * @brief default constructor.
          */
         flex_tree(const allocator_type& allocator = allocator_type()) noexcept 
-            : detail__::flex_tree_base__<Type, Allocator>(allocator)
+            : detail__::flex_tree_base__<Type, Allocator, Policy>(allocator)
         { }
         
         /**
@@ -1468,16 +2926,19 @@ namespace trl
         flex_tree(const flex_tree& other) noexcept
             : flex_tree(other.get_allocator())
         { 
-            if (other.impl_M_.header_M_->has_children_M_())
-            { this->impl_M_.header_M_->size_M_ = this->copy_children_M_(this->impl_M_.header_M_, other.impl_M_.header_M_); }
+            if (other.impl_M_.header_M_.has_children_M_())
+            { this->impl_M_.header_M_.size_M_ = this->copy_children_M_(&this->impl_M_.header_M_, &other.impl_M_.header_M_); }
+            this->impl_M_.header_M_.find_layers_M_();
+            if constexpr (Policy::ancestor_index)
+            { this->impl_M_.header_M_.index_tree_M_(this->impl_M_.header_M_.size_M_); }
         }
 
         /**
-         * @brief move constructor.
+         * @brief move constructor. does not allocate, costs O(top-level nodes) to re-point them to the new header.
          */
         flex_tree(flex_tree&& other) noexcept
-            : flex_tree()
-        { swap(*this, other); }
+            : detail__::flex_tree_base__<Type, Allocator, Policy>(std::move(other))
+        { }
 
         /**
          * @brief copy assignment using copy-swap-idiom.
@@ -1496,10 +2957,11 @@ namespace trl
 
         /**
          * @brief swap specialization.
+         * @note the header-nodes are part of the trees, so end()-iterators of both trees are invalidated.
          */
         friend void 
         swap(flex_tree& a, flex_tree& b) noexcept
-        { std::swap(a.impl_M_, b.impl_M_); }
+        { a.impl_M_.swap_M_(b.impl_M_); }
 
         /**
          * @}
@@ -1512,21 +2974,21 @@ namespace trl
 
         /**
          * @tparam Traversal the algorithm used to traverse the tree.
-         * @return an iterator to the first-child-node of the root, or end() if the tree is empty.
+         * @return an iterator to the first node in `Traversal`-order, or end() if the tree is empty.
          */
         template <traversal Traversal = default_traversal>
         iterator<Traversal> 
         begin() noexcept
-        { return iterator<Traversal>(this->impl_M_.header_M_->first_child_M_); }
+        { return iterator<Traversal>(iterator<Traversal>::first_M_(&this->impl_M_.header_M_)); }
         
         /**
          * @tparam Traversal the algorithm used to traverse the tree.
-         * @return a const-iterator to the first-child-node of the root, or end() if the tree is empty.
+         * @return a const-iterator to the first node in `Traversal`-order, or end() if the tree is empty.
          */
         template <traversal Traversal = default_traversal>
         const_iterator<Traversal> 
         cbegin() const noexcept
-        { return const_iterator<Traversal>(this->impl_M_.header_M_->first_child_M_); }
+        { return const_iterator<Traversal>(const_iterator<Traversal>::first_M_(&this->impl_M_.header_M_)); }
 
         /**
          * @tparam Traversal the algorithm used to traverse the tree.
@@ -1535,7 +2997,7 @@ namespace trl
         template <traversal Traversal = default_traversal>
         iterator<Traversal> 
         end() noexcept
-        { return iterator<Traversal>(this->impl_M_.header_M_); }
+        { return iterator<Traversal>(&this->impl_M_.header_M_); }
 
         /**
          * @tparam Traversal the algorithm used to traverse the tree.
@@ -1544,7 +3006,7 @@ namespace trl
         template <traversal Traversal = default_traversal>
         const_iterator<Traversal> 
         cend() const noexcept
-        { return const_iterator<Traversal>(this->impl_M_.header_M_); }
+        { return const_iterator<Traversal>(&this->impl_M_.header_M_); }
 
         /**
          * @tparam Traversal the algorithm used to traverse the tree.
@@ -1553,11 +3015,12 @@ namespace trl
         template <traversal Traversal = default_traversal>
         reverse_iterator<Traversal> 
         rbegin() noexcept
-    #ifdef TRL_FLEX_TREE_STL_REVERSE_ITER
-        { return reverse_iterator<Traversal>(this->end<Traversal>()); }
-    #else
-        { return reverse_iterator<Traversal>(--this->end<Traversal>()); }
-    #endif
+        {
+            if constexpr (Policy::stl_reverse_iterator)
+            { return reverse_iterator<Traversal>(this->end<Traversal>()); }
+            else
+            { return reverse_iterator<Traversal>(--this->end<Traversal>()); }
+        }
         
         /**
          * @tparam Traversal the algorithm used to traverse the tree.
@@ -1566,11 +3029,12 @@ namespace trl
         template <traversal Traversal = default_traversal>
         const_reverse_iterator<Traversal> 
         crbegin() const noexcept
-    #ifdef TRL_FLEX_TREE_STL_REVERSE_ITER
-        { return reverse_iterator<Traversal>(this->end<Traversal>()); }
-    #else
-        { return const_reverse_iterator<Traversal>(--this->cend<Traversal>()); }
-    #endif
+        {
+            if constexpr (Policy::stl_reverse_iterator)
+            { return const_reverse_iterator<Traversal>(this->cend<Traversal>()); }
+            else
+            { return const_reverse_iterator<Traversal>(--this->cend<Traversal>()); }
+        }
 
         /**
          * @tparam Traversal the algorithm used to traverse the tree.
@@ -1579,11 +3043,12 @@ namespace trl
         template <traversal Traversal = default_traversal>
         reverse_iterator<Traversal> 
         rend() noexcept
-    #ifdef TRL_FLEX_TREE_STL_REVERSE_ITER
-        { return reverse_iterator<Traversal>(this->begin<Traversal>()); }
-    #else
-        { return reverse_iterator<Traversal>(this->end<Traversal>()); }
-    #endif
+        {
+            if constexpr (Policy::stl_reverse_iterator)
+            { return reverse_iterator<Traversal>(this->begin<Traversal>()); }
+            else
+            { return reverse_iterator<Traversal>(this->end<Traversal>()); }
+        }
 
         /**
          * @tparam Traversal the algorithm used to traverse the tree.
@@ -1592,11 +3057,12 @@ namespace trl
         template <traversal Traversal = default_traversal>
         const_reverse_iterator<Traversal> 
         crend() const noexcept
-    #ifdef TRL_FLEX_TREE_STL_REVERSE_ITER
-        { return const_reverse_iterator<Traversal>(this->cbegin<Traversal>()); }
-    #else
-        { return const_reverse_iterator<Traversal>(this->cend<Traversal>()); }
-    #endif
+        {
+            if constexpr (Policy::stl_reverse_iterator)
+            { return const_reverse_iterator<Traversal>(this->cbegin<Traversal>()); }
+            else
+            { return const_reverse_iterator<Traversal>(this->cend<Traversal>()); }
+        }
 
         /**
          * @}
@@ -1615,13 +3081,28 @@ namespace trl
          * @return an iterator to the newly created node.
          */
         template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
         prepend(iterator<Traversal> where, const value_type& value) noexcept
         {
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(value);
-            new__->hook_as_first_child_M_(where); ++this->impl_M_.header_M_->size_M_;
+            new__->hook_as_first_child_M_(where); ++this->impl_M_.header_M_.size_M_;
+            this->impl_M_.header_M_.hooked_M_(new__, 1ull);
             return iterator<Traversal>(new__);
         }
+
+        /**
+         * @brief insert a new child-node as `where`'s first-child, moving `value` into it.
+         * @param where an iterator to the new node's parent node.
+         * @param value the value that is moved into the new node.
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the newly created node.
+         */
+        template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
+        iterator<Traversal> 
+        prepend(iterator<Traversal> where, value_type&& value) noexcept
+        { return this->emplace_prepend(where, std::move(value)); }
     
         /**
          * @brief emplace a new child-node as `where`'s first-child.
@@ -1631,11 +3112,13 @@ namespace trl
          * @return an iterator to the newly created node.
          */
         template <traversal Traversal = default_traversal, typename... Args>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
         emplace_prepend(iterator<Traversal> where, Args&&... args) noexcept
         {
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(std::forward<Args>(args)...);
-            new__->hook_as_first_child_M_(where); ++this->impl_M_.header_M_->size_M_;
+            new__->hook_as_first_child_M_(where); ++this->impl_M_.header_M_.size_M_;
+            this->impl_M_.header_M_.hooked_M_(new__, 1ull);
             return iterator<Traversal>(new__);
         }
         
@@ -1647,14 +3130,29 @@ namespace trl
          * @return an iterator to the newly created node.
          */
         template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
         append(iterator<Traversal> where, const value_type& value) noexcept
         {
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(value); 
-            new__->hook_as_last_child_M_(where); ++this->impl_M_.header_M_->size_M_;
+            new__->hook_as_last_child_M_(where); ++this->impl_M_.header_M_.size_M_;
+            this->impl_M_.header_M_.hooked_M_(new__, 1ull);
             return iterator<Traversal>(new__);
         }
 
+        /**
+         * @brief insert a new child-node as `where`'s last-child, moving `value` into it.
+         * @param where an iterator to the new node's parent node.
+         * @param value the value that is moved into the new node.
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the newly created node.
+         */
+        template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
+        iterator<Traversal> 
+        append(iterator<Traversal> where, value_type&& value) noexcept
+        { return this->emplace_append(where, std::move(value)); }
+
         /**
          * @brief emplace a new child-node as `where`'s last-child.
          * @param where an iterator to the new node's parent node.
@@ -1663,11 +3161,13 @@ namespace trl
          * @return an iterator to the newly created node.
          */
         template <traversal Traversal = default_traversal, typename... Args>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
         emplace_append(iterator<Traversal> where, Args&&... args) noexcept
         {
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(std::forward<Args>(args)...);
-            new__->hook_as_last_child_M_(where); ++this->impl_M_.header_M_->size_M_;
+            new__->hook_as_last_child_M_(where); ++this->impl_M_.header_M_.size_M_;
+            this->impl_M_.header_M_.hooked_M_(new__, 1ull);
             return iterator<Traversal>(new__);
         }
 
@@ -1681,18 +3181,34 @@ namespace trl
          * - `where` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
-        insert_after(iterator<Traversal> where, const value_type& value) TRL_NOEXCEPT
+        insert_after(iterator<Traversal> where, const value_type& value) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!where.node_ptr_M_()->is_root_M_()); }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(value);
-            new__->hook_as_next_sibling_M_(where); ++this->impl_M_.header_M_->size_M_;
+            new__->hook_as_next_sibling_M_(where); ++this->impl_M_.header_M_.size_M_;
+            this->impl_M_.header_M_.hooked_M_(new__, 1ull);
             return iterator<Traversal>(new__);
         }
+
+        /**
+         * @brief insert a new node as the next sibling of `where`, moving `value` into it.
+         * @param where an iterator to the new node's previous sibling.
+         * @param value the value that is moved into the new node.
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the newly created node.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - `where` is an `end()`-iterator.
+         */
+        template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
+        iterator<Traversal> 
+        insert_after(iterator<Traversal> where, value_type&& value) noexcept(!Policy::exceptions)
+        { return this->emplace_after(where, std::move(value)); }
             
         /**
          * @brief emplace a new node as the next sibling of `where`.
@@ -1704,16 +3220,17 @@ namespace trl
          * - `where` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal, typename... Args>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
-        emplace_after(iterator<Traversal> where, Args&&... args) TRL_NOEXCEPT
+        emplace_after(iterator<Traversal> where, Args&&... args) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!where.node_ptr_M_()->is_root_M_()); }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(std::forward<Args>(args)...);
-            new__->hook_as_next_sibling_M_(where); ++this->impl_M_.header_M_->size_M_;
+            new__->hook_as_next_sibling_M_(where); ++this->impl_M_.header_M_.size_M_;
+            this->impl_M_.header_M_.hooked_M_(new__, 1ull);
             return iterator<Traversal>(new__);
         }
 
@@ -1727,18 +3244,34 @@ namespace trl
          * - `where` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
-        insert_before(iterator<Traversal> where, const value_type& value) TRL_NOEXCEPT
+        insert_before(iterator<Traversal> where, const value_type& value) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!where.node_ptr_M_()->is_root_M_()); }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(value);
-            new__->hook_as_prev_sibling_M_(where); ++this->impl_M_.header_M_->size_M_;
+            new__->hook_as_prev_sibling_M_(where); ++this->impl_M_.header_M_.size_M_;
+            this->impl_M_.header_M_.hooked_M_(new__, 1ull);
             return iterator<Traversal>(new__);
         }
+
+        /**
+         * @brief insert a new node as the previous sibling of `where`, moving `value` into it.
+         * @param where an iterator to the new node's next sibling.
+         * @param value the value that is moved into the new node.
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the newly created node.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - `where` is an `end()`-iterator.
+         */
+        template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
+        iterator<Traversal> 
+        insert_before(iterator<Traversal> where, value_type&& value) noexcept(!Policy::exceptions)
+        { return this->emplace_before(where, std::move(value)); }
     
         /**
          * @brief emplace a new node as the previous sibling of `where`.
@@ -1750,16 +3283,17 @@ namespace trl
          * - `where` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal, typename... Args>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
-        emplace_before(iterator<Traversal> where, Args&&... args) TRL_NOEXCEPT
+        emplace_before(iterator<Traversal> where, Args&&... args) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!where.node_ptr_M_()->is_root_M_()); }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(std::forward<Args>(args)...); 
-            new__->hook_as_prev_sibling_M_(where); ++this->impl_M_.header_M_->size_M_;
+            new__->hook_as_prev_sibling_M_(where); ++this->impl_M_.header_M_.size_M_;
+            this->impl_M_.header_M_.hooked_M_(new__, 1ull);
             return iterator<Traversal>(new__);
         }
         
@@ -1783,21 +3317,26 @@ namespace trl
          * - `src` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
-        concatenate_append(iterator<Traversal> where, iterator<Traversal> src) TRL_NOEXCEPT
+        concatenate_append(iterator<Traversal> where, iterator<Traversal> src) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
-        #else
-            assert(!src.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); } }
+            else
+            { assert(!src.node_ptr_M_()->is_root_M_()); }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(*src);
+            std::size_t copied__{1ull};
             if (src.node_ptr_M_()->has_children_M_())
-            { this->copy_children_M_(new__, src); }
+            { copied__ += this->copy_children_M_(new__, src); }
+            if constexpr (Policy::subtree_size)
+            { new__->subtree_size_M_ = copied__; }
             new__->hook_as_last_child_M_(where);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(new__, new__->parent_M_->depth_M_());
-        #endif
+            new__->hook_descendant_layers_M_();
+            this->impl_M_.header_M_.hooked_M_(new__, copied__);
+            this->impl_M_.header_M_.size_M_ += copied__;
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(new__); }
             return iterator<Traversal>(new__);
         }
 
@@ -1811,21 +3350,26 @@ namespace trl
          * - `src` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
-        concatenate_prepend(iterator<Traversal> where, iterator<Traversal> src) TRL_NOEXCEPT
+        concatenate_prepend(iterator<Traversal> where, iterator<Traversal> src) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
-        #else
-            assert(!src.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); } }
+            else
+            { assert(!src.node_ptr_M_()->is_root_M_()); }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(*src);
+            std::size_t copied__{1ull};
             if (src.node_ptr_M_()->has_children_M_())
-            { this->copy_children_M_(new__, src); }
+            { copied__ += this->copy_children_M_(new__, src); }
+            if constexpr (Policy::subtree_size)
+            { new__->subtree_size_M_ = copied__; }
             new__->hook_as_first_child_M_(where);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(new__, new__->parent_M_->depth_M_());
-        #endif
+            new__->hook_descendant_layers_M_();
+            this->impl_M_.header_M_.hooked_M_(new__, copied__);
+            this->impl_M_.header_M_.size_M_ += copied__;
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(new__); }
             return iterator<Traversal>(new__);
         }
 
@@ -1839,23 +3383,32 @@ namespace trl
          * - `where` or `src` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
-        concatenate_after(iterator<Traversal> where, iterator<Traversal> src) TRL_NOEXCEPT
+        concatenate_after(iterator<Traversal> where, iterator<Traversal> src) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-            if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-            assert(!src.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            {
+                if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
+                if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
+            }
+            else
+            {
+                assert(!where.node_ptr_M_()->is_root_M_());
+                assert(!src.node_ptr_M_()->is_root_M_());
+            }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(*src);
+            std::size_t copied__{1ull};
             if (src.node_ptr_M_()->has_children_M_())
-            { this->copy_children_M_(new__, src); }
+            { copied__ += this->copy_children_M_(new__, src); }
+            if constexpr (Policy::subtree_size)
+            { new__->subtree_size_M_ = copied__; }
             new__->hook_as_next_sibling_M_(where);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(new__, new__->parent_M_->depth_M_());
-        #endif
+            new__->hook_descendant_layers_M_();
+            this->impl_M_.header_M_.hooked_M_(new__, copied__);
+            this->impl_M_.header_M_.size_M_ += copied__;
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(new__); }
             return iterator<Traversal>(new__);
         }
 
@@ -1869,23 +3422,32 @@ namespace trl
          * - `where` or `src` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal>
+            requires (!detail__::stacked_breadth_first__<Traversal, Policy>)
         iterator<Traversal> 
-        concatenate_before(iterator<Traversal> where, iterator<Traversal> src) TRL_NOEXCEPT
+        concatenate_before(iterator<Traversal> where, iterator<Traversal> src) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-            if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-            assert(!src.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            {
+                if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
+                if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
+            }
+            else
+            {
+                assert(!where.node_ptr_M_()->is_root_M_());
+                assert(!src.node_ptr_M_()->is_root_M_());
+            }
             node_ptr_T_ new__ = this->impl_M_.get_node_M_(*src);
+            std::size_t copied__{1ull};
             if (src.node_ptr_M_()->has_children_M_())
-            { this->copy_children_M_(new__, src); }
+            { copied__ += this->copy_children_M_(new__, src); }
+            if constexpr (Policy::subtree_size)
+            { new__->subtree_size_M_ = copied__; }
             new__->hook_as_prev_sibling_M_(where);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(new__, new__->parent_M_->depth_M_());
-        #endif
+            new__->hook_descendant_layers_M_();
+            this->impl_M_.header_M_.hooked_M_(new__, copied__);
+            this->impl_M_.header_M_.size_M_ += copied__;
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(new__); }
             return iterator<Traversal>(new__);
         }
 
@@ -1912,22 +3474,29 @@ namespace trl
          */
         template <traversal Traversal = default_traversal>
         void
-        splice_append(iterator<Traversal> where, iterator<Traversal> src) TRL_NOEXCEPT
+        splice_append(iterator<Traversal> where, iterator<Traversal> src) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
-            if (where.node_ptr_M_()->is_child_of(src.node_ptr_M_())) { throw std::invalid_argument("'where' cannot be a child-node of 'src'"); }
-            if (where == src) { throw std::invalid_argument("cannot splice to the same node"); }
-        #else
-            assert(!src.node_ptr_M_()->is_root_M_())
-            assert(!where.node_ptr_M_()->is_child_of(src.node_ptr_M_()))
-            assert(where != src);
-        #endif
+            if constexpr (Policy::exceptions)
+            {
+                if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
+                if (where.node_ptr_M_()->is_child_of(src.node_ptr_M_())) { throw std::invalid_argument("'where' cannot be a child-node of 'src'"); }
+                if (where == src) { throw std::invalid_argument("cannot splice to the same node"); }
+            }
+            else
+            {
+                assert(!src.node_ptr_M_()->is_root_M_());
+                assert(!where.node_ptr_M_()->is_child_of(src.node_ptr_M_()));
+                assert(where != src);
+            }
+            ++this->impl_M_.header_M_.modifications_M_;
+            this->impl_M_.header_M_.unhooking_M_(src.ptr_M_);
+            src.ptr_M_->unhook_descendant_layers_M_();
             src.ptr_M_->unhook_M_();
             src.ptr_M_->hook_as_last_child_M_(where);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(src, src.ptr_M_->parent_M_->depth_M_());
-        #endif
+            src.ptr_M_->hook_descendant_layers_M_();
+            this->impl_M_.header_M_.moved_M_(src.ptr_M_);
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(src.ptr_M_); }
         }
 
         /**
@@ -1942,22 +3511,29 @@ namespace trl
          */
         template <traversal Traversal = default_traversal>
         void
-        splice_prepend(iterator<Traversal> where, iterator<Traversal> src) TRL_NOEXCEPT
+        splice_prepend(iterator<Traversal> where, iterator<Traversal> src) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
-            if (where.node_ptr_M_()->is_child_of(src.node_ptr_M_())) { throw std::invalid_argument("'where' cannot be a child-node of 'src'"); }
-            if (where == src) { throw std::invalid_argument("cannot splice to the same node"); }
-        #else
-            assert(!src.node_ptr_M_()->is_root_M_())
-            assert(!where.node_ptr_M_()->is_child_of(src.node_ptr_M_()))
-            assert(where != src);
-        #endif
+            if constexpr (Policy::exceptions)
+            {
+                if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
+                if (where.node_ptr_M_()->is_child_of(src.node_ptr_M_())) { throw std::invalid_argument("'where' cannot be a child-node of 'src'"); }
+                if (where == src) { throw std::invalid_argument("cannot splice to the same node"); }
+            }
+            else
+            {
+                assert(!src.node_ptr_M_()->is_root_M_());
+                assert(!where.node_ptr_M_()->is_child_of(src.node_ptr_M_()));
+                assert(where != src);
+            }
+            ++this->impl_M_.header_M_.modifications_M_;
+            this->impl_M_.header_M_.unhooking_M_(src.ptr_M_);
+            src.ptr_M_->unhook_descendant_layers_M_();
             src.ptr_M_->unhook_M_();
             src.ptr_M_->hook_as_first_child_M_(where);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(src, src.ptr_M_->parent_M_->depth_M_());
-        #endif
+            src.ptr_M_->hook_descendant_layers_M_();
+            this->impl_M_.header_M_.moved_M_(src.ptr_M_);
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(src.ptr_M_); }
         }
 
         /**
@@ -1972,23 +3548,30 @@ namespace trl
          */
         template <traversal Traversal = default_traversal>
         void
-        splice_after(iterator<Traversal> where, iterator<Traversal> src) TRL_NOEXCEPT
+        splice_after(iterator<Traversal> where, iterator<Traversal> src) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-            if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
-            if (where.node_ptr_M_()->is_child_of(src.node_ptr_M_())) { throw std::invalid_argument("'where' cannot be a child-node of 'src'"); }
-            if (where == src) { throw std::invalid_argument("cannot splice to the same node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_() && !src.node_ptr_M_()->is_root_M_());
-            assert(!where.node_ptr_M_()->is_child_of(src.node_ptr_M_()))
-            assert(where != src);
-        #endif
+            if constexpr (Policy::exceptions)
+            {
+                if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
+                if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
+                if (where.node_ptr_M_()->is_child_of(src.node_ptr_M_())) { throw std::invalid_argument("'where' cannot be a child-node of 'src'"); }
+                if (where == src) { throw std::invalid_argument("cannot splice to the same node"); }
+            }
+            else
+            {
+                assert(!where.node_ptr_M_()->is_root_M_() && !src.node_ptr_M_()->is_root_M_());
+                assert(!where.node_ptr_M_()->is_child_of(src.node_ptr_M_()));
+                assert(where != src);
+            }
+            ++this->impl_M_.header_M_.modifications_M_;
+            this->impl_M_.header_M_.unhooking_M_(src.ptr_M_);
+            src.ptr_M_->unhook_descendant_layers_M_();
             src.ptr_M_->unhook_M_();
             src.ptr_M_->hook_as_next_sibling_M_(where);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(src, src.ptr_M_->parent_M_->depth_M_());
-        #endif
+            src.ptr_M_->hook_descendant_layers_M_();
+            this->impl_M_.header_M_.moved_M_(src.ptr_M_);
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(src.ptr_M_); }
         }
 
         /**
@@ -2003,23 +3586,30 @@ namespace trl
          */
         template <traversal Traversal = default_traversal>
         void
-        splice_before(iterator<Traversal> where, iterator<Traversal> src) TRL_NOEXCEPT
+        splice_before(iterator<Traversal> where, iterator<Traversal> src) noexcept(!Policy::exceptions)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-            if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
-            if (where.node_ptr_M_()->is_child_of(src.node_ptr_M_())) { throw std::invalid_argument("'where' cannot be a child-node of 'src'"); }
-            if (where == src) { throw std::invalid_argument("cannot splice to the same node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_() && !src.node_ptr_M_()->is_root_M_());
-            assert(!where.node_ptr_M_()->is_child_of(src.node_ptr_M_()))
-            assert(where != src);
-        #endif
+            if constexpr (Policy::exceptions)
+            {
+                if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
+                if (src.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'src' cannot point to the root-node"); }
+                if (where.node_ptr_M_()->is_child_of(src.node_ptr_M_())) { throw std::invalid_argument("'where' cannot be a child-node of 'src'"); }
+                if (where == src) { throw std::invalid_argument("cannot splice to the same node"); }
+            }
+            else
+            {
+                assert(!where.node_ptr_M_()->is_root_M_() && !src.node_ptr_M_()->is_root_M_());
+                assert(!where.node_ptr_M_()->is_child_of(src.node_ptr_M_()));
+                assert(where != src);
+            }
+            ++this->impl_M_.header_M_.modifications_M_;
+            this->impl_M_.header_M_.unhooking_M_(src.ptr_M_);
+            src.ptr_M_->unhook_descendant_layers_M_();
             src.ptr_M_->unhook_M_();
             src.ptr_M_->hook_as_prev_sibling_M_(where);
-        #ifdef TRL_FLEX_TREE_FAST_DEPTH
-            this->update_depth_M_(src, src.ptr_M_->parent_M_->depth_M_());
-        #endif
+            src.ptr_M_->hook_descendant_layers_M_();
+            this->impl_M_.header_M_.moved_M_(src.ptr_M_);
+            if constexpr (Policy::depth_count)
+            { this->update_depth_M_(src.ptr_M_); }
         }
         
         /**
@@ -2036,34 +3626,73 @@ namespace trl
          * @param where the node to be erased.
          * @tparam Traversal the algorithm used to traverse the tree.
          * @return an iterator to the next valid node in the tree.
+         * for breadth-first iterators of trees without layer-links this steps `where` like `++`, which may allocate.
          * @note exceptions are thrown / the behaviour is undefined if:
          * - `where` is an `end()`-iterator.
          */
         template <traversal Traversal = default_traversal>
         iterator<Traversal> 
-        erase(iterator<Traversal> where) TRL_NOEXCEPT
+        erase(iterator<Traversal> where) noexcept(!Policy::exceptions && !detail__::stacked_breadth_first__<Traversal, Policy>)
         {
-        #ifndef TRL_FLEX_TREE_NOEXCEPT
-            if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); }
-        #else
-            assert(!where.node_ptr_M_()->is_root_M_());
-        #endif
+            if constexpr (Policy::exceptions)
+            { if (where.node_ptr_M_()->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!where.node_ptr_M_()->is_root_M_()); }
+            this->impl_M_.header_M_.unhooking_M_(where.node_ptr_M_());
             if (where.node_ptr_M_()->has_children_M_())
-            { this->impl_M_.header_M_->size_M_ -= this->erase_children_M_(where); }
+            { this->impl_M_.header_M_.size_M_ -= this->erase_children_M_(where); }
             iterator<Traversal> next__ = std::next(where);
             where.node_ptr_M_()->unhook_M_();
             this->impl_M_.put_node_M_(static_cast<node_ptr_T_>(where.node_ptr_M_()));
+            --this->impl_M_.header_M_.size_M_;
             return next__;
         }
         
         /**
          * @brief erases every node in the tree.
+         * @details
+         * for trivially destructible value-types whose nodes come from an arena-allocator (e.g. trl::pool_allocator)
+         * that holds no other objects, the whole arena is released at once instead of erasing every node.
          */
         void 
         clear() noexcept
         { 
             if (this->size()) 
-            { this->impl_M_.header_M_->size_M_ -= this->erase_children_M_(this->impl_M_.header_M_); } 
+            { this->erase_all_M_(); } 
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name memory-layout
+         * @{
+         */
+
+        /**
+         * @brief
+         * moves every node into a new allocation from the tree's allocator, in `Traversal`-order, and frees the old ones.
+         * @details
+         * after many insertions, erasures and splices the nodes are scattered over the heap, so iterating the tree
+         * misses the cache on almost every node. compacting allocates them in the order they are visited in. with trl::pool_allocator
+         * (or any allocator with a reserve_sequential(count)) they are taken from one contiguous range, so consecutive nodes lie
+         * `chunk_size()` apart. other allocators decide the addresses themselves: a general-purpose heap may hand out the new nodes
+         * side by side (the old ones are only freed afterwards), but nothing guarantees it.
+         * the structure of the tree does not change. values are moved if their move-constructor is noexcept and copied otherwise.
+         * O(n), and all nodes exist twice for a moment. if an allocation or a copy throws, the tree is left unchanged.
+         * @tparam Traversal the order to lay the nodes out in, e.g. depth_first_pre_order or breadth_first_in_order.
+         * @note invalidates every iterator into the tree.
+         */
+        template <traversal Traversal = depth_first_pre_order>
+        void
+        compact()
+        {
+            std::vector<node_ptr_T_> order__;
+            order__.reserve(this->size());
+            for (iterator<Traversal> it__ = this->begin<Traversal>(); it__ != this->end<Traversal>(); ++it__)
+            { order__.push_back(static_cast<node_ptr_T_>(it__.node_ptr_M_())); }
+            this->relocate_nodes_M_(order__);
         }
 
         /**
@@ -2090,6 +3719,114 @@ namespace trl
             return res__;
         }
 
+        /**
+         * @brief
+         * the node at position `index` in `Traversal`-order, without iterating over the nodes in front of it.
+         * descends from the top-level nodes and skips every subtree in front of the node as a whole, one sibling at a time.
+         * O(depth + the previous siblings of the node and of each of it's ancestors) instead of O(index): O(depth * fanout)
+         * for bounded fanout, but up to O(n) if the path crosses a wide layer (e.g. a tree of n top-level nodes).
+         * the sibling-walk is a deliberate limit: skipping siblings in sub-linear time would need an index over every
+         * children-list (e.g. a balanced tree of their subtree-sizes), which every insertion, erasure and splice would have to
+         * keep up to date as well. trees that need fast positional access should not put most of their nodes on one layer.
+         * @param index the position of the node, `size()` for `end()`.
+         * @tparam Traversal depth_first_pre_order or depth_first_post_order. needs flex_tree_policy::subtree_size.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - `index` is larger than `size()`.
+         */
+        template <traversal Traversal = default_traversal>
+            requires (Policy::subtree_size && (Traversal == depth_first_pre_order || Traversal == depth_first_post_order))
+        iterator<Traversal>
+        nth(std::size_t index) noexcept(!Policy::exceptions)
+        {
+            if constexpr (Policy::exceptions)
+            { if (index > this->size()) { throw std::out_of_range("index out of range"); } }
+            else
+            { assert(index <= this->size()); }
+            if (index == this->size())
+            { return this->end<Traversal>(); }
+            return iterator<Traversal>(node_base_T_::template nth_node_M_<Traversal == depth_first_post_order>(
+                static_cast<base_ptr_T_>(&this->impl_M_.header_M_), index));
+        }
+
+        template <traversal Traversal = default_traversal>
+            requires (Policy::subtree_size && (Traversal == depth_first_pre_order || Traversal == depth_first_post_order))
+        const_iterator<Traversal>
+        nth(std::size_t index) const noexcept(!Policy::exceptions)
+        {
+            if constexpr (Policy::exceptions)
+            { if (index > this->size()) { throw std::out_of_range("index out of range"); } }
+            else
+            { assert(index <= this->size()); }
+            if (index == this->size())
+            { return this->cend<Traversal>(); }
+            return const_iterator<Traversal>(node_base_T_::template nth_node_M_<Traversal == depth_first_post_order>(
+                static_cast<c_base_ptr_T_>(&this->impl_M_.header_M_), index));
+        }
+
+        /**
+         * @brief
+         * the position of a node in `Traversal`-order, without iterating over the nodes in front of it.
+         * sums up the subtree-sizes of the previous siblings of the node and of it's ancestors.
+         * O(depth + the previous siblings of the node and of each of it's ancestors), the same bound as `nth()`.
+         * @return the position of `where`, `size()` for `end()`. `nth<Traversal>(index_of(where)) == where`.
+         * @tparam Traversal depth_first_pre_order or depth_first_post_order. needs flex_tree_policy::subtree_size.
+         */
+        template <traversal Traversal>
+            requires (Policy::subtree_size && (Traversal == depth_first_pre_order || Traversal == depth_first_post_order))
+        std::size_t
+        index_of(const_iterator<Traversal> where) const noexcept
+        {
+            if (where.node_ptr_M_()->is_root_M_())
+            { return this->size(); }
+            return node_base_T_::template index_of_node_M_<Traversal == depth_first_post_order>(where.node_ptr_M_());
+        }
+
+        template <traversal Traversal>
+            requires (Policy::subtree_size && (Traversal == depth_first_pre_order || Traversal == depth_first_post_order))
+        std::size_t
+        index_of(iterator<Traversal> where) const noexcept
+        { return this->index_of(const_iterator<Traversal>(where)); }
+
+        /**
+         * @brief
+         * picks a node uniformly at random, by drawing a position and finding it like `nth()` does.
+         * the same bound as `nth()`: O(depth + the previous siblings of the picked node and of each of it's ancestors),
+         * up to O(n) for wide layers, the same deliberate limit as `nth()`. nothing has to be rebuilt after modifying the tree.
+         * @param rng the random-number-engine to draw from, e.g. `std::mt19937`.
+         * @return an iterator to the picked node, or `end()` if the tree is empty. needs flex_tree_policy::subtree_size.
+         */
+        template <traversal Traversal = default_traversal, std::uniform_random_bit_generator Rng>
+            requires (Policy::subtree_size)
+        iterator<Traversal>
+        sample(Rng& rng)
+        { return this->sample_in_subtree(this->end<Traversal>(), rng); }
+
+        template <traversal Traversal = default_traversal, std::uniform_random_bit_generator Rng>
+            requires (Policy::subtree_size)
+        const_iterator<Traversal>
+        sample(Rng& rng) const
+        { return this->sample_in_subtree(this->cend<Traversal>(), rng); }
+
+        /**
+         * @brief
+         * picks a node uniformly at random from the subtree of `where`, `where` itself included.
+         * the same bound as `sample()`, counted from `where` down.
+         * @param where the root of the subtree to pick from. `end()` picks from the whole tree, like `sample()`.
+         * @param rng the random-number-engine to draw from, e.g. `std::mt19937`.
+         * @return an iterator to the picked node, or `end()` if `where` is `end()` and the tree is empty. needs flex_tree_policy::subtree_size.
+         */
+        template <traversal Traversal, std::uniform_random_bit_generator Rng>
+            requires (Policy::subtree_size)
+        iterator<Traversal>
+        sample_in_subtree(iterator<Traversal> where, Rng& rng)
+        { return iterator<Traversal>(this->sample_node_M_(where.node_ptr_M_(), rng)); }
+
+        template <traversal Traversal, std::uniform_random_bit_generator Rng>
+            requires (Policy::subtree_size)
+        const_iterator<Traversal>
+        sample_in_subtree(const_iterator<Traversal> where, Rng& rng) const
+        { return const_iterator<Traversal>(this->sample_node_M_(where.node_ptr_M_(), rng)); }
+
         /**
          * @brief get the associated allocator object.
          * @return instance of `allocator_type` 
@@ -2103,19 +3840,35 @@ namespace trl
          */
         constexpr std::size_t 
         size() const noexcept
-        { return this->impl_M_.header_M_->size_M_; }
+        { return this->impl_M_.header_M_.size_M_; }
 
         /**
          * @return true if the tree is empty.
          */
         constexpr bool
         empty() const noexcept
-        { return !this->impl_M_.header_M_->size_M_; }
+        { return !this->impl_M_.header_M_.size_M_; }
 
         /**
          * @}
          */
 
+    protected:
+
+        /* draws one of the nodes in the subtree of where__ (for the header: one of all nodes, or the header if there are none) */
+        template <typename BasePtr__, typename Rng__>
+        BasePtr__
+        sample_node_M_(BasePtr__ where__, Rng__& rng__) const
+        {
+            std::size_t count__{node_traits::subtree_size(const_iterator<>(where__))};
+            if (!count__)
+            { return where__; }
+            std::size_t k__{std::uniform_int_distribution<std::size_t>(0ull, count__ - 1ull)(rng__)};
+            if (where__->is_root_M_())
+            { return node_base_T_::template nth_node_M_<false>(where__, k__); }
+            return k__ ? node_base_T_::template nth_node_M_<false>(where__, k__ - 1ull) : where__;
+        }
+
     };
 
 }
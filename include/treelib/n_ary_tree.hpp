@@ -1,6 +1,7 @@
+/********************************/
 #ifndef TRL_N_ARY_TREE_HPP
 #define TRL_N_ARY_TREE_HPP
-
+/********************************/
 /**
  * @file    n_ary_tree.hpp
  * @date    25/08/2025
@@ -10,17 +11,30 @@
  * C++ STL-like implementation of an n-ary tree data-structure.
  *
  * @details
- * 
+ * every node of a trl::n_ary_tree holds exactly `Size` child-slots in an inline array, so the k-th child of a node
+ * is one index away (`node_traits::child(it, k)`), instead of k steps along a sibling-list like in trl::flex_tree.
+ * slots can be empty, e.g. a binary tree where a node only has a right child. there are no sibling-links: the next and
+ * previous sibling of a node are the next and previous occupied slots of it's parent, found in O(Size).
+ * meant for quadtree/octree-like structures and decision-trees with a small, fixed branching factor.
  *
+ * it offers the same traversal-orders, iterators and node_traits as trl::flex_tree, and takes the same policy
+ * (trl::flex_tree_policy) for it's exceptions and default traversal. the node-layout members of the policy have no effect.
  */
 /********************************/
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <iterator>
 #include <initializer_list>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <vector>
+#include <algorithm>
 #include <cassert>
+
+#include "flex_tree.hpp"
 /********************************/
 
 namespace trl
@@ -28,16 +42,1432 @@ namespace trl
 
     namespace detail__
     {
+        /**
+         * @brief
+         * the child-slots and parent-link of every node, including the header.
+         */
+        template <std::size_t Size__>
+        struct n_ary_tree_node_base__
+        {
+            static_assert(Size__ > 0ull, "trl::n_ary_tree: nodes need at least one child-slot");
+
+            using base_ptr_T_ = n_ary_tree_node_base__*;
+            /* slots and counts of small arities fit a byte, which keeps e.g. octree-nodes a pointer smaller */
+            using slot_T_ = typename std::conditional<(Size__ < 256ull), std::uint8_t, std::size_t>::type;
+
+            /* returned by the slot-searches if there is no occupied slot */
+            static constexpr std::size_t npos_M_{Size__};
+
+            base_ptr_T_ parent_M_{nullptr}; /* only nullptr for the header */
+            base_ptr_T_ children_M_[Size__]{};
+            slot_T_ slot_M_{0}; /* index of this node in parent_M_->children_M_ */
+            slot_T_ child_count_M_{0};
+
+            bool
+            is_root_M_() const noexcept
+            { return !this->parent_M_; }
+
+            bool
+            has_children_M_() const noexcept
+            { return this->child_count_M_ != 0; }
+
+            /* first occupied slot in [from__, Size__) */
+            std::size_t
+            find_next_M_(std::size_t from__) const noexcept
+            {
+                for (; from__ < Size__; ++from__)
+                { if (this->children_M_[from__]) { return from__; } }
+                return npos_M_;
+            }
+
+            /* last occupied slot in [0, before__) */
+            std::size_t
+            find_prev_M_(std::size_t before__) const noexcept
+            {
+                while (before__-- > 0ull)
+                { if (this->children_M_[before__]) { return before__; } }
+                return npos_M_;
+            }
+
+            /* expects child-nodes */
+            base_ptr_T_
+            first_child_M_() const noexcept
+            { return this->children_M_[this->find_next_M_(0ull)]; }
+
+            /* expects child-nodes */
+            base_ptr_T_
+            last_child_M_() const noexcept
+            { return this->children_M_[this->find_prev_M_(Size__)]; }
+
+            /* the next occupied slot of the parent, nullptr if there is none */
+            base_ptr_T_
+            next_sibling_M_() const noexcept
+            {
+                if (this->is_root_M_())
+                { return nullptr; }
+                std::size_t slot__{this->parent_M_->find_next_M_(this->slot_M_ + 1ull)};
+                return slot__ == npos_M_ ? nullptr : this->parent_M_->children_M_[slot__];
+            }
+
+            /* the previous occupied slot of the parent, nullptr if there is none */
+            base_ptr_T_
+            prev_sibling_M_() const noexcept
+            {
+                if (this->is_root_M_())
+                { return nullptr; }
+                std::size_t slot__{this->parent_M_->find_prev_M_(this->slot_M_)};
+                return slot__ == npos_M_ ? nullptr : this->parent_M_->children_M_[slot__];
+            }
+
+            bool
+            is_first_child_M_() const noexcept
+            { return !this->prev_sibling_M_(); }
+
+            bool
+            is_last_child_M_() const noexcept
+            { return !this->next_sibling_M_(); }
+
+            std::size_t
+            depth_M_() const noexcept
+            {
+                std::size_t depth__{0ull};
+                for (const n_ary_tree_node_base__* iter__{this}; !iter__->is_root_M_(); iter__ = iter__->parent_M_)
+                { ++depth__; }
+                return depth__;
+            }
+
+            /* true if this node is ancestor__ or one of it's descendants */
+            bool
+            is_in_subtree_of_M_(const n_ary_tree_node_base__* ancestor__) const noexcept
+            {
+                for (const n_ary_tree_node_base__* iter__{this}; iter__; iter__ = iter__->parent_M_)
+                { if (iter__ == ancestor__) { return true; } }
+                return false;
+            }
+
+            /* expects the slot to be free */
+            void
+            hook_M_(base_ptr_T_ parent__, std::size_t slot__) noexcept
+            {
+                this->parent_M_ = parent__;
+                this->slot_M_ = static_cast<slot_T_>(slot__);
+                parent__->children_M_[slot__] = this;
+                ++parent__->child_count_M_;
+            }
+
+            void
+            unhook_M_() noexcept
+            {
+                this->parent_M_->children_M_[this->slot_M_] = nullptr;
+                --this->parent_M_->child_count_M_;
+                this->parent_M_ = nullptr;
+            }
+
+            /**
+             * @name traversal-steps, shared by the iterators and the tree. all of them are cyclic over the root.
+             * @{
+             */
+
+            static base_ptr_T_
+            leftmost_M_(base_ptr_T_ node__) noexcept
+            {
+                while (node__->has_children_M_())
+                { node__ = node__->first_child_M_(); }
+                return node__;
+            }
+
+            static base_ptr_T_
+            rightmost_M_(base_ptr_T_ node__) noexcept
+            {
+                while (node__->has_children_M_())
+                { node__ = node__->last_child_M_(); }
+                return node__;
+            }
+
+            /* the next node in pre-order that is not a descendant of node__ */
+            static base_ptr_T_
+            skip_subtree_M_(base_ptr_T_ node__) noexcept
+            {
+                while (!node__->is_root_M_())
+                {
+                    if (base_ptr_T_ next__ = node__->next_sibling_M_())
+                    { return next__; }
+                    node__ = node__->parent_M_;
+                }
+                return node__;
+            }
+
+            static base_ptr_T_
+            pre_order_next_M_(base_ptr_T_ node__) noexcept
+            { return node__->has_children_M_() ? node__->first_child_M_() : skip_subtree_M_(node__); }
+
+            static base_ptr_T_
+            pre_order_prev_M_(base_ptr_T_ node__) noexcept
+            {
+                if (node__->is_root_M_())
+                { return rightmost_M_(node__); }
+                if (base_ptr_T_ prev__ = node__->prev_sibling_M_())
+                { return rightmost_M_(prev__); }
+                return node__->parent_M_;
+            }
+
+            static base_ptr_T_
+            post_order_next_M_(base_ptr_T_ node__) noexcept
+            {
+                if (node__->is_root_M_())
+                { return leftmost_M_(node__); }
+                if (base_ptr_T_ next__ = node__->next_sibling_M_())
+                { return leftmost_M_(next__); }
+                return node__->parent_M_;
+            }
+
+            static base_ptr_T_
+            post_order_prev_M_(base_ptr_T_ node__) noexcept
+            {
+                if (node__->has_children_M_())
+                { return node__->last_child_M_(); }
+                while (!node__->is_root_M_())
+                {
+                    if (base_ptr_T_ prev__ = node__->prev_sibling_M_())
+                    { return prev__; }
+                    node__ = node__->parent_M_;
+                }
+                return node__;
+            }
+
+            /**
+             * @}
+             */
+        };
+
+        /**
+         * @brief
+         * an actual node in the tree.
+         */
+        template <typename ValTp__, std::size_t Size__>
+        struct n_ary_tree_node__
+            : public n_ary_tree_node_base__<Size__>
+        {
+            ValTp__ value_M_;
+
+            template <typename... Args>
+            n_ary_tree_node__(Args&&... args__) : value_M_(std::forward<Args>(args__)...) { }
+        };
+
+        /**
+         * @brief
+         * top-most dummy node of any n_ary_tree. it's slots hold the top-level nodes.
+         */
+        template <std::size_t Size__>
+        struct n_ary_tree_header_node__
+            : public n_ary_tree_node_base__<Size__>
+        {
+            std::size_t size_M_{0ull};
+
+            n_ary_tree_header_node__() = default;
+
+            /* the children point back to their header */
+            n_ary_tree_header_node__(const n_ary_tree_header_node__&) = delete;
+            n_ary_tree_header_node__& operator=(const n_ary_tree_header_node__&) = delete;
+
+            void
+            reset_M_() noexcept
+            {
+                std::fill(std::begin(this->children_M_), std::end(this->children_M_), nullptr);
+                this->child_count_M_ = 0;
+                this->size_M_ = 0ull;
+            }
+
+            /* expects this header to be empty */
+            void
+            take_children_M_(n_ary_tree_header_node__& other__) noexcept
+            {
+                std::copy(std::begin(other__.children_M_), std::end(other__.children_M_), std::begin(this->children_M_));
+                this->child_count_M_ = other__.child_count_M_;
+                this->size_M_ = other__.size_M_;
+                this->adopt_children_M_();
+                other__.reset_M_();
+            }
+
+            void
+            swap_M_(n_ary_tree_header_node__& other__) noexcept
+            {
+                std::swap_ranges(std::begin(this->children_M_), std::end(this->children_M_), std::begin(other__.children_M_));
+                std::swap(this->child_count_M_, other__.child_count_M_);
+                std::swap(this->size_M_, other__.size_M_);
+                this->adopt_children_M_();
+                other__.adopt_children_M_();
+            }
+
+        private:
+
+            void
+            adopt_children_M_() noexcept
+            {
+                for (auto* child__ : this->children_M_)
+                { if (child__) { child__->parent_M_ = this; } }
+            }
+        };
+
+        /**
+         * @brief
+         * describes one node of an n_ary_tree and it's child-nodes in an initializer-list, like flex_tree's initializer.
+         * the listed child-nodes occupy the first slots of their parent.
+         */
+        template <typename Alloc__, std::size_t Size__>
+        struct n_ary_tree_node_initializer__
+        {
+            using value_T_ = typename std::allocator_traits<Alloc__>::value_type;
+            using node_T_ = n_ary_tree_node__<value_T_, Size__>;
+            using node_ptr_T_ = node_T_*;
+            using node_alloc_T_ = std::allocator_traits<Alloc__>::template rebind_alloc<node_T_>;
+
+            static constexpr std::size_t max_args_M_{4ull};
+
+            /* type-erased addresses of the constructor-arguments, and the function that knows their types */
+            const void* args_M_[max_args_M_]{};
+            node_ptr_T_ (*make_M_)(node_alloc_T_&, const void* const*){nullptr};
+            std::initializer_list<n_ary_tree_node_initializer__> children_M_{};
+
+            /* non-copyable, it refers to temporaries */
+            n_ary_tree_node_initializer__(const n_ary_tree_node_initializer__&) = delete;
+            n_ary_tree_node_initializer__& operator=(const n_ary_tree_node_initializer__&) = delete;
+
+            template <typename... Args>
+                requires (sizeof...(Args) <= max_args_M_) && std::constructible_from<value_T_, Args...>
+            n_ary_tree_node_initializer__(Args&&... args__)
+                : args_M_{ static_cast<const void*>(std::addressof(args__))... }
+                , make_M_(&make_node_from_M_<Args...>)
+            { }
+
+            template <typename Arg>
+                requires std::constructible_from<value_T_, Arg>
+            n_ary_tree_node_initializer__(Arg&& arg__, std::initializer_list<n_ary_tree_node_initializer__> ilist__)
+                : args_M_{ static_cast<const void*>(std::addressof(arg__)) }
+                , make_M_(&make_node_from_M_<Arg>)
+                , children_M_(ilist__)
+            { }
+
+            /**
+             * @brief allocates and constructs the node this initializer describes.
+             */
+            node_ptr_T_
+            make_node_M_(node_alloc_T_& alloc__) const
+            { return this->make_M_(alloc__, this->args_M_); }
+
+            template <typename... Args>
+            static node_ptr_T_
+            make_node_from_M_(node_alloc_T_& alloc__, const void* const* args__)
+            { return make_node_from_M_<Args...>(alloc__, args__, std::index_sequence_for<Args...>{}); }
+
+            template <typename... Args, std::size_t... Idx>
+            static node_ptr_T_
+            make_node_from_M_(node_alloc_T_& alloc__, const void* const* args__, std::index_sequence<Idx...>)
+            {
+                node_ptr_T_ new__ = std::allocator_traits<node_alloc_T_>::allocate(alloc__, 1);
+                try
+                {
+                    std::allocator_traits<node_alloc_T_>::construct(alloc__, new__,
+                        std::forward<Args>(*static_cast<std::remove_reference_t<Args>*>(const_cast<void*>(args__[Idx])))...);
+                }
+                catch (...)
+                { std::allocator_traits<node_alloc_T_>::deallocate(alloc__, new__, 1); throw; }
+                return new__;
+            }
+        };
+
+        template <typename ValTp__, std::size_t Size__, typename Policy__, bool Const__>
+        struct n_ary_tree_iterator_base__
+        {
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = typename std::conditional<Const__, const ValTp__, ValTp__>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = value_type*;
+            using reference = value_type&;
+
+            using self_T_ = n_ary_tree_iterator_base__;
+            using policy_T_ = Policy__;
+            using node_base_T_ = n_ary_tree_node_base__<Size__>;
+            using base_ptr_T_ = node_base_T_*;
+            using node_ptr_T_ = n_ary_tree_node__<ValTp__, Size__>*;
+
+            base_ptr_T_ ptr_M_{nullptr};
+
+            n_ary_tree_iterator_base__() = default;
+
+            explicit n_ary_tree_iterator_base__(base_ptr_T_ ptr__) noexcept
+                : ptr_M_(ptr__)
+            { }
+
+            base_ptr_T_
+            node_ptr_M_() const noexcept
+            { return this->ptr_M_; }
+
+            /**
+             * @name node-value accessors.
+             * @{
+             */
+
+            [[nodiscard]]
+            reference
+            operator*() const noexcept(!Policy__::iterator_exceptions)
+            {
+                if constexpr (Policy__::iterator_exceptions)
+                { if (this->ptr_M_->is_root_M_()) { throw std::logic_error("cannot dereference end()-iterator"); } }
+                else
+                { assert(!this->ptr_M_->is_root_M_()); /* the header holds no value. check only in debug. */ }
+                return static_cast<node_ptr_T_>(this->ptr_M_)->value_M_;
+            }
+
+            [[nodiscard]]
+            pointer
+            operator->() const noexcept(!Policy__::iterator_exceptions)
+            { return std::addressof(**this); }
+
+            /**
+             * @}
+             */
+
+            /**
+             * @name equality-operators. all iterators are comparable via the node they point to.
+             * @{
+             */
+
+            friend bool
+            operator==(const self_T_& a, const self_T_& b)
+            { return a.ptr_M_ == b.ptr_M_; }
+
+            friend bool /* can be omitted as of C++20 */
+            operator!=(const self_T_& a, const self_T_& b)
+            { return !(a == b); }
+
+            /**
+             * @}
+             */
+        };
+
+        /**
+         * @brief an iterator to an n_ary_tree.
+         * @tparam Trav__ the traversal-algorithm used by the iterator.
+         */
+        template <traversal Trav__, typename ValTp__, std::size_t Size__, typename Policy__, bool Const__>
+        struct n_ary_tree_iterator__; /* primary template. not to be instantiated. */
+
+        /**
+         * @brief partial-specialization for the depth-first traversals.
+         */
+        template <traversal Trav__, typename ValTp__, std::size_t Size__, typename Policy__, bool Const__>
+            requires (Trav__ == depth_first_pre_order || Trav__ == depth_first_post_order)
+        struct n_ary_tree_iterator__<Trav__, ValTp__, Size__, Policy__, Const__>
+            : public n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>
+        {
+            using self_T_ = n_ary_tree_iterator__<Trav__, ValTp__, Size__, Policy__, Const__>;
+            using base_T_ = n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>;
+            using node_base_T_ = typename base_T_::node_base_T_;
+            using base_T_::base_T_; /* use constructors of base-class */
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            n_ary_tree_iterator__(const n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, false>& other) noexcept
+                requires Const__
+                : base_T_(other.ptr_M_)
+            { }
+
+            n_ary_tree_iterator__(const n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>& other) noexcept
+                : base_T_(other.ptr_M_)
+            { }
+
+            self_T_&
+            operator++() noexcept
+            {
+                if constexpr (Trav__ == depth_first_pre_order)
+                { this->ptr_M_ = node_base_T_::pre_order_next_M_(this->ptr_M_); }
+                else
+                { this->ptr_M_ = node_base_T_::post_order_next_M_(this->ptr_M_); }
+                return *this;
+            }
+
+            self_T_&
+            operator--() noexcept
+            {
+                if constexpr (Trav__ == depth_first_pre_order)
+                { this->ptr_M_ = node_base_T_::pre_order_prev_M_(this->ptr_M_); }
+                else
+                { this->ptr_M_ = node_base_T_::post_order_prev_M_(this->ptr_M_); }
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; --(*this); return old; }
+        };
+
+        /**
+         * @brief
+         * partial-specialization for breadth-first traversal.
+         * @details
+         * visits the nodes in the same alternating order as flex_tree's breadth-first iterators. without layer-links
+         * it keeps the rest of the current layer and the child-nodes of the visited nodes, like flex_tree's iterator
+         * for trees without layer-links (see trl::flex_tree_policy): a forward-iterator only, that owns O(width) memory
+         * and has to collect the layer of a position once if it was not reached by iteration.
+         */
+        template <traversal Trav__, typename ValTp__, std::size_t Size__, typename Policy__, bool Const__>
+            requires (Trav__ == breadth_first_in_order || Trav__ == breadth_first_reverse_order)
+        struct n_ary_tree_iterator__<Trav__, ValTp__, Size__, Policy__, Const__>
+            : public n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>
+        {
+            using iterator_category = std::forward_iterator_tag;
+            using self_T_ = n_ary_tree_iterator__<Trav__, ValTp__, Size__, Policy__, Const__>;
+            using base_T_ = n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>;
+            using base_ptr_T_ = typename base_T_::base_ptr_T_;
+
+            static constexpr bool reversed_M_{Trav__ == breadth_first_reverse_order};
+
+            /* true while the current layer is walked left-to-right, the root counts as depth 0 */
+            bool direction_M_{reversed_M_};
+            /* the nodes of the current layer that are still to be visited, the next one on top */
+            std::vector<base_ptr_T_> layer_M_{};
+            /* the child-nodes of the visited nodes of the current layer */
+            std::vector<base_ptr_T_> next_layer_M_{};
+
+            n_ary_tree_iterator__() = default;
+
+            explicit n_ary_tree_iterator__(base_ptr_T_ ptr__)
+                : base_T_(ptr__)
+            {
+                if (ptr__ && !ptr__->is_root_M_())
+                { this->seek_M_(); }
+            }
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            n_ary_tree_iterator__(const n_ary_tree_iterator__<Trav__, ValTp__, Size__, Policy__, false>& other)
+                requires Const__
+                : base_T_(other.ptr_M_)
+                , direction_M_(other.direction_M_)
+                , layer_M_(other.layer_M_)
+                , next_layer_M_(other.next_layer_M_)
+            { }
+
+            n_ary_tree_iterator__(const n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, false>& other)
+                requires Const__
+                : n_ary_tree_iterator__(other.ptr_M_)
+            { }
+
+            n_ary_tree_iterator__(const n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>& other)
+                : n_ary_tree_iterator__(other.ptr_M_)
+            { }
+
+            self_T_&
+            operator++()
+            {
+                base_ptr_T_ root__{this->ptr_M_};
+                this->push_children_M_(this->ptr_M_);
+                if (this->layer_M_.empty())
+                {
+                    if (this->next_layer_M_.empty())
+                    {
+                        while (!root__->is_root_M_())
+                        { root__ = root__->parent_M_; }
+                        this->ptr_M_ = root__;
+                        this->direction_M_ = reversed_M_;
+                        return *this;
+                    }
+                    this->layer_M_.swap(this->next_layer_M_);
+                    this->direction_M_ = !this->direction_M_;
+                }
+                this->ptr_M_ = this->layer_M_.back();
+                this->layer_M_.pop_back();
+                return *this;
+            }
+
+            self_T_
+            operator++(int)
+            { self_T_ old{*this}; ++(*this); return old; }
+
+        private:
+
+            /*
+             * pushes the child-nodes of a visited node in the direction of it's layer.
+             * the next layer is walked the other way around, so it pops off in the right order.
+             */
+            void
+            push_children_M_(base_ptr_T_ node__)
+            {
+                if (!node__->has_children_M_())
+                { return; }
+                std::size_t pushed__{this->next_layer_M_.size()};
+                for (base_ptr_T_ child__ : node__->children_M_)
+                { if (child__) { this->next_layer_M_.push_back(child__); } }
+                if (!this->direction_M_)
+                { std::reverse(this->next_layer_M_.begin() + pushed__, this->next_layer_M_.end()); }
+            }
+
+            /*
+             * restores the stacks for a position that was not reached by iteration: collects it's layer left-to-right,
+             * pushes the children of the nodes visited before it and queues the ones after it.
+             */
+            void
+            seek_M_()
+            {
+                std::size_t depth__{this->ptr_M_->depth_M_()};
+                base_ptr_T_ root__{this->ptr_M_};
+                while (!root__->is_root_M_())
+                { root__ = root__->parent_M_; }
+
+                std::vector<base_ptr_T_> layer__;
+                base_ptr_T_ iter__{root__->first_child_M_()};
+                std::size_t iter_depth__{1ull};
+                while (!iter__->is_root_M_())
+                {
+                    if (iter_depth__ == depth__)
+                    { layer__.push_back(iter__); }
+                    else if (iter__->has_children_M_())
+                    { iter__ = iter__->first_child_M_(); ++iter_depth__; continue; }
+                    while (!iter__->is_root_M_() && iter__->is_last_child_M_())
+                    { iter__ = iter__->parent_M_; --iter_depth__; }
+                    if (!iter__->is_root_M_())
+                    { iter__ = iter__->next_sibling_M_(); }
+                }
+
+                this->direction_M_ = static_cast<bool>(depth__ % 2) != reversed_M_;
+                if (!this->direction_M_) /* layer__ in visiting order */
+                { std::reverse(layer__.begin(), layer__.end()); }
+                auto where__ = std::find(layer__.begin(), layer__.end(), this->ptr_M_);
+                for (auto iter__ = layer__.begin(); iter__ != where__; ++iter__)
+                { this->push_children_M_(*iter__); }
+                this->layer_M_.assign(layer__.rbegin(), std::make_reverse_iterator(where__ + 1));
+            }
+        };
+
+        /**
+         * @details
+         * reverse-iterator adaptor for n_ary_tree::iterator. like flex_tree's, it points at the node it dereferences,
+         * instead of one behind it like std::reverse_iterator.
+         */
+        template <typename Iter__>
+        struct n_ary_tree_reverse_iterator__
+        {
+            using base_type = Iter__;
+            using iterator_category = typename base_type::iterator_category;
+            using value_type = typename base_type::value_type;
+            using difference_type = typename base_type::difference_type;
+            using pointer = typename base_type::pointer;
+            using reference = typename base_type::reference;
+
+            using self_T_ = n_ary_tree_reverse_iterator__;
+            using self_ref_T_ = self_T_&;
+            using c_self_ref_T_ = const self_T_&;
+
+            base_type instance_M_;
+
+            n_ary_tree_reverse_iterator__() = default;
+
+            n_ary_tree_reverse_iterator__(const base_type& iter) noexcept
+                : instance_M_(iter)
+            { }
+
+            /* const-promotion, the same way the underlying iterators are promoted */
+            template <typename OtherIter__>
+                requires (!std::is_same_v<OtherIter__, Iter__>) && std::constructible_from<Iter__, const OtherIter__&>
+            n_ary_tree_reverse_iterator__(const n_ary_tree_reverse_iterator__<OtherIter__>& other) noexcept
+                : instance_M_(other.instance_M_)
+            { }
+
+            base_type&
+            base()
+            { return this->instance_M_; }
+
+            const base_type&
+            base() const
+            { return this->instance_M_; }
+
+            self_ref_T_
+            operator++() noexcept
+            { --this->instance_M_; return *this; }
 
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; --this->instance_M_; return old; }
+
+            self_ref_T_
+            operator--() noexcept
+            { ++this->instance_M_; return *this; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; ++this->instance_M_; return old; }
+
+            [[nodiscard]]
+            reference
+            operator*() const noexcept(noexcept(*std::declval<const base_type&>()))
+            { return *this->instance_M_; }
+
+            [[nodiscard]]
+            pointer
+            operator->() const noexcept(noexcept(*std::declval<const base_type&>()))
+            { return std::addressof(*this->instance_M_); }
+
+            friend bool
+            operator==(c_self_ref_T_ a, c_self_ref_T_ b)
+            { return a.instance_M_ == b.instance_M_; }
+
+            friend bool
+            operator!=(c_self_ref_T_ a, c_self_ref_T_ b)
+            { return a.instance_M_ != b.instance_M_; }
+        };
+
+        /**
+         * @brief
+         * iterates over the occupied child-slots of a node, like flex_tree's leaf_iterator.
+         * to be used with `trl::n_ary_tree<>::node_traits::lbegin()`/`lend()`.
+         */
+        template <typename ValTp__, std::size_t Size__, typename Policy__, bool Const__>
+        struct n_ary_tree_leaf_iterator__
+            : public n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>
+        {
+            using self_T_ = n_ary_tree_leaf_iterator__;
+            using base_T_ = n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>;
+            using base_T_::base_T_; /* use constructors of base-class */
+
+            /*
+             * const-iterators can be constructed from regular
+             * iterators (promoted to const), but not vice-versa.
+             */
+
+            n_ary_tree_leaf_iterator__(const n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, false>& other) noexcept
+                requires Const__
+                : base_T_(other.ptr_M_)
+            { }
+
+            n_ary_tree_leaf_iterator__(const n_ary_tree_iterator_base__<ValTp__, Size__, Policy__, Const__>& other) noexcept
+                : base_T_(other.ptr_M_)
+            { }
+
+            self_T_&
+            operator++() noexcept
+            {
+                auto* next__ = this->ptr_M_->next_sibling_M_();
+                this->ptr_M_ = next__ ? next__ : this->ptr_M_->parent_M_;
+                return *this;
+            }
+
+            self_T_&
+            operator--() noexcept
+            {
+                auto* prev__ = this->ptr_M_->prev_sibling_M_();
+                this->ptr_M_ = prev__ ? prev__ : this->ptr_M_->parent_M_;
+                return *this;
+            }
+
+            self_T_
+            operator++(int) noexcept
+            { self_T_ old{*this}; ++(*this); return old; }
+
+            self_T_
+            operator--(int) noexcept
+            { self_T_ old{*this}; --(*this); return old; }
+        };
+
+        /**
+         * @brief
+         * provides (optionally exception-safe) information about a node's placement in an n_ary_tree.
+         * next/previous refer to the neighbouring occupied slots of the parent.
+         */
+        template <std::size_t Size__, typename Policy__>
+        struct n_ary_tree_node_traits__
+        {
+
+            template <typename IteratorType>
+            static IteratorType
+            parent(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.node_ptr_M_()->is_root_M_()) { throw std::logic_error("root-node cannot have a parent-node"); } }
+                else
+                { assert(!iter.node_ptr_M_()->is_root_M_()); }
+                return IteratorType(iter.node_ptr_M_()->parent_M_);
+            }
+
+            /**
+             * @return an iterator to the child-node in slot `k` of iter. O(1).
+             * @note exceptions are thrown / behaviour is undefined if:
+             * - `k` is not smaller than the arity of the tree.
+             * - slot `k` is empty.
+             */
+            template <typename IteratorType>
+            static IteratorType
+            child(IteratorType iter, std::size_t k) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                {
+                    if (k >= Size__) { throw std::out_of_range("child-slot out of range"); }
+                    if (!iter.node_ptr_M_()->children_M_[k]) { throw std::logic_error("node does not have a child-node in this slot"); }
+                }
+                else
+                { assert(k < Size__ && iter.node_ptr_M_()->children_M_[k]); }
+                return IteratorType(iter.node_ptr_M_()->children_M_[k]);
+            }
+
+            /* false for empty slots and slots out of range */
+            template <typename IteratorType>
+            static bool
+            has_child(IteratorType iter, std::size_t k) noexcept
+            { return k < Size__ && iter.node_ptr_M_()->children_M_[k]; }
+
+            /* the index of iter in the child-slots of it's parent */
+            template <typename IteratorType>
+            static std::size_t
+            slot(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.node_ptr_M_()->is_root_M_()) { throw std::logic_error("root-node cannot be a child-node"); } }
+                else
+                { assert(!iter.node_ptr_M_()->is_root_M_()); }
+                return iter.node_ptr_M_()->slot_M_;
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            next(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                auto* next__ = iter.node_ptr_M_()->next_sibling_M_();
+                if constexpr (Policy__::exceptions)
+                { if (!next__) { throw std::logic_error("node does not have a next node"); } }
+                else
+                { assert(next__); }
+                return IteratorType(next__);
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            previous(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                auto* prev__ = iter.node_ptr_M_()->prev_sibling_M_();
+                if constexpr (Policy__::exceptions)
+                { if (!prev__) { throw std::logic_error("node does not have a previous node"); } }
+                else
+                { assert(prev__); }
+                return IteratorType(prev__);
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            first_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (!iter.node_ptr_M_()->has_children_M_()) { throw std::logic_error("node does not have any child-nodes"); } }
+                else
+                { assert(iter.node_ptr_M_()->has_children_M_()); }
+                return IteratorType(iter.node_ptr_M_()->first_child_M_());
+            }
+
+            template <typename IteratorType>
+            static IteratorType
+            last_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (!iter.node_ptr_M_()->has_children_M_()) { throw std::logic_error("node does not have any child-nodes"); } }
+                else
+                { assert(iter.node_ptr_M_()->has_children_M_()); }
+                return IteratorType(iter.node_ptr_M_()->last_child_M_());
+            }
+
+            template <typename IteratorType>
+            static std::size_t
+            depth(IteratorType iter) noexcept
+            { return iter.node_ptr_M_()->depth_M_(); }
+
+            template <typename IteratorType>
+            static std::size_t
+            child_count(IteratorType iter) noexcept
+            { return iter.node_ptr_M_()->child_count_M_; }
+
+            template <typename IteratorType>
+            static bool
+            is_root(IteratorType iter) noexcept
+            { return iter.node_ptr_M_()->is_root_M_(); }
+
+            template <typename IteratorType>
+            static bool
+            is_first_child(IteratorType iter) noexcept
+            { return iter.node_ptr_M_()->is_first_child_M_(); }
+
+            template <typename IteratorType>
+            static bool
+            is_last_child(IteratorType iter) noexcept
+            { return iter.node_ptr_M_()->is_last_child_M_(); }
+
+            template <typename IteratorType>
+            static bool
+            has_next(IteratorType iter) noexcept
+            { return iter.node_ptr_M_()->next_sibling_M_(); }
+
+            template <typename IteratorType>
+            static bool
+            has_previous(IteratorType iter) noexcept
+            { return iter.node_ptr_M_()->prev_sibling_M_(); }
+
+            template <typename IteratorType>
+            static bool
+            has_children(IteratorType iter) noexcept
+            { return iter.node_ptr_M_()->has_children_M_(); }
+
+            template <typename IteratorType>
+            static bool
+            is_only_child(IteratorType iter) noexcept(!Policy__::exceptions)
+            {
+                if constexpr (Policy__::exceptions)
+                { if (iter.node_ptr_M_()->is_root_M_()) { throw std::logic_error("root-node cannot be a child-node"); } }
+                else
+                { assert(!iter.node_ptr_M_()->is_root_M_()); }
+                return iter.node_ptr_M_()->parent_M_->child_count_M_ == 1;
+            }
+
+            template <typename IterTp__>
+            using leaf_iter_T_ = n_ary_tree_leaf_iterator__<std::remove_const_t<typename IterTp__::value_type>, Size__,
+                typename IterTp__::policy_T_, std::is_const_v<typename IterTp__::value_type>>;
+
+            template <typename IteratorType>
+            static leaf_iter_T_<IteratorType>
+            lbegin(IteratorType iter) noexcept(!Policy__::exceptions)
+            { return leaf_iter_T_<IteratorType>(first_child(iter).node_ptr_M_()); }
+
+            template <typename IteratorType>
+            static leaf_iter_T_<IteratorType>
+            lend(IteratorType iter) noexcept
+            { return leaf_iter_T_<IteratorType>(iter.node_ptr_M_()); }
+
+        };
     }
 
-    template <typename Type, std::size_t Size, 
-            typename Allocator = std::allocator<Type>>
+    /**
+     * @brief C++ STL-like implementation of an n-ary tree-data-structure.
+     * @tparam Type the type that every node should contain.
+     * @tparam Size the number of child-slots of every node.
+     * @tparam Allocator an allocator type.
+     * @tparam Policy compile-time configuration of the tree, see trl::flex_tree_policy. only exceptions, iterator_exceptions
+     *         and default_traversal apply.
+     */
+    template <typename Type, std::size_t Size,
+            typename Allocator = std::allocator<Type>, typename Policy = flex_tree_policy>
     class n_ary_tree
     {
+    public:
+
+        static constexpr traversal default_traversal = Policy::default_traversal;
+        static constexpr std::size_t arity = Size;
+
+        using value_type = Type;
+        using allocator_type = Allocator;
+        using policy_type = Policy;
+        /* only refers to the values in the braces like flex_tree::initializer_type, never store an initializer-list of it */
+        using initializer_type = detail__::n_ary_tree_node_initializer__<Allocator, Size>;
+
+        template <traversal Traversal = default_traversal>
+        using iterator = detail__::n_ary_tree_iterator__<Traversal, value_type, Size, Policy, false>;
+
+        template <traversal Traversal = default_traversal>
+        using const_iterator = detail__::n_ary_tree_iterator__<Traversal, value_type, Size, Policy, true>;
+
+        template <traversal Traversal = default_traversal>
+        using reverse_iterator = detail__::n_ary_tree_reverse_iterator__<iterator<Traversal>>;
+
+        template <traversal Traversal = default_traversal>
+        using const_reverse_iterator = detail__::n_ary_tree_reverse_iterator__<const_iterator<Traversal>>;
+
+        using leaf_iterator = detail__::n_ary_tree_leaf_iterator__<value_type, Size, Policy, false>;
+        using const_leaf_iterator = detail__::n_ary_tree_leaf_iterator__<value_type, Size, Policy, true>;
+
+        using node_traits = detail__::n_ary_tree_node_traits__<Size, Policy>;
+
+    protected:
+
+        using node_T_ = detail__::n_ary_tree_node__<value_type, Size>;
+        using node_ptr_T_ = node_T_*;
+        using c_node_ptr_T_ = const node_T_*;
+        using node_base_T_ = detail__::n_ary_tree_node_base__<Size>;
+        using base_ptr_T_ = node_base_T_*;
+        using c_base_ptr_T_ = const node_base_T_*;
+        using header_T_ = detail__::n_ary_tree_header_node__<Size>;
+        using node_alloc_T_ = typename std::allocator_traits<allocator_type>::template rebind_alloc<node_T_>;
+
+        struct n_ary_tree_impl__
+            : public node_alloc_T_
+        {
+            header_T_ header_M_; /* embedded, empty trees and moves do not allocate */
+
+            n_ary_tree_impl__(const node_alloc_T_& node_alloc__)
+                : node_alloc_T_(node_alloc__)
+            { }
+
+            n_ary_tree_impl__(const n_ary_tree_impl__&) = delete;
+            n_ary_tree_impl__& operator=(const n_ary_tree_impl__&) = delete;
+
+            /* the allocator travels with the nodes */
+            n_ary_tree_impl__(n_ary_tree_impl__&& o__) noexcept
+                : node_alloc_T_(o__.get_node_alloc_M_())
+            { this->header_M_.take_children_M_(o__.header_M_); }
+
+            void
+            swap_M_(n_ary_tree_impl__& o__) noexcept
+            {
+                using std::swap;
+                swap(this->get_node_alloc_M_(), o__.get_node_alloc_M_());
+                this->header_M_.swap_M_(o__.header_M_);
+            }
+
+            template <typename... Args__>
+            node_ptr_T_
+            get_node_M_(Args__&&... args__)
+            {
+                node_ptr_T_ new__ = std::allocator_traits<node_alloc_T_>::allocate(this->get_node_alloc_M_(), 1);
+                try
+                { std::allocator_traits<node_alloc_T_>::construct(this->get_node_alloc_M_(), new__, std::forward<Args__>(args__)...); }
+                catch (...)
+                { std::allocator_traits<node_alloc_T_>::deallocate(this->get_node_alloc_M_(), new__, 1); throw; }
+                return new__;
+            }
+
+            void
+            put_node_M_(node_ptr_T_ node__)
+            {
+                std::allocator_traits<node_alloc_T_>::destroy(this->get_node_alloc_M_(), node__);
+                std::allocator_traits<node_alloc_T_>::deallocate(this->get_node_alloc_M_(), node__, 1);
+            }
+
+            node_alloc_T_&
+            get_node_alloc_M_()
+            { return *this; }
+
+            const node_alloc_T_&
+            get_node_alloc_M_() const
+            { return *this; }
+        };
+
+    public:
+
+        /**
+         * @name constructors and special member functions
+         * @{
+         */
+
+        /**
+         * @brief default constructor.
+         */
+        n_ary_tree(const allocator_type& allocator = allocator_type()) noexcept
+            : impl_M_(node_alloc_T_(allocator))
+        { }
+
+        /**
+         * @brief
+         * initializes the tree using a recursively constructed initializer-list, like flex_tree.
+         * the listed child-nodes of a node occupy it's first slots.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - a node lists more than `Size` child-nodes.
+         */
+        n_ary_tree(std::initializer_list<initializer_type> ilist, const allocator_type& allocator = allocator_type())
+            : n_ary_tree(allocator)
+        {
+            try
+            { this->from_initializer_list_M_(&this->impl_M_.header_M_, ilist); }
+            catch (...)
+            { this->clear(); throw; }
+        }
+
+        /**
+         * @brief initializer-list assignment. leaves the tree empty if a value-constructor throws.
+         */
+        n_ary_tree&
+        operator=(std::initializer_list<initializer_type> ilist)
+        {
+            this->clear();
+            try
+            { this->from_initializer_list_M_(&this->impl_M_.header_M_, ilist); }
+            catch (...)
+            { this->clear(); throw; }
+            return *this;
+        }
+
+        /**
+         * @brief destructor. clears up remaining nodes.
+         */
+        ~n_ary_tree() noexcept
+        { this->clear(); }
+
+        /**
+         * @brief copy constructor. copies every node into the same slots.
+         */
+        n_ary_tree(const n_ary_tree& other)
+            : impl_M_(std::allocator_traits<node_alloc_T_>::select_on_container_copy_construction(other.impl_M_.get_node_alloc_M_()))
+        {
+            try
+            { this->copy_from_M_(other); }
+            catch (...)
+            { this->clear(); throw; }
+        }
+
+        /**
+         * @brief copy assignment.
+         */
+        n_ary_tree&
+        operator=(const n_ary_tree& other)
+        {
+            if (this != &other)
+            {
+                n_ary_tree copy__(other);
+                this->impl_M_.swap_M_(copy__.impl_M_);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief move constructor.
+         */
+        n_ary_tree(n_ary_tree&& other) noexcept
+            : impl_M_(std::move(other.impl_M_))
+        { }
+
+        /**
+         * @brief move assignment.
+         */
+        n_ary_tree&
+        operator=(n_ary_tree&& other) noexcept
+        {
+            if (this != &other)
+            {
+                this->clear();
+                this->impl_M_.swap_M_(other.impl_M_);
+            }
+            return *this;
+        }
+
+        friend void
+        swap(n_ary_tree& a, n_ary_tree& b) noexcept
+        { a.impl_M_.swap_M_(b.impl_M_); }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name iteration
+         * @{
+         */
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the first node in `Traversal`-order, or end() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        begin() noexcept(Traversal == depth_first_pre_order || Traversal == depth_first_post_order)
+        { return ++this->end<Traversal>(); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-iterator to the first node in `Traversal`-order, or end() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        cbegin() const noexcept(Traversal == depth_first_pre_order || Traversal == depth_first_post_order)
+        { return ++this->cend<Traversal>(); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return an iterator to the header of the tree, which does not hold a value.
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        end() noexcept
+        { return iterator<Traversal>(&this->impl_M_.header_M_); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-iterator to the header of the tree, which does not hold a value.
+         */
+        template <traversal Traversal = default_traversal>
+        const_iterator<Traversal>
+        cend() const noexcept
+        { return const_iterator<Traversal>(const_cast<base_ptr_T_>(static_cast<c_base_ptr_T_>(&this->impl_M_.header_M_))); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a reverse-iterator to the last node in `Traversal`-order, or rend() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        reverse_iterator<Traversal>
+        rbegin() noexcept
+        { return reverse_iterator<Traversal>(--this->end<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-reverse-iterator to the last node in `Traversal`-order, or crend() if the tree is empty.
+         */
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        crbegin() const noexcept
+        { return const_reverse_iterator<Traversal>(--this->cend<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a reverse-iterator to the header of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        reverse_iterator<Traversal>
+        rend() noexcept
+        { return reverse_iterator<Traversal>(this->end<Traversal>()); }
+
+        /**
+         * @tparam Traversal the algorithm used to traverse the tree.
+         * @return a const-reverse-iterator to the header of the tree.
+         */
+        template <traversal Traversal = default_traversal>
+        const_reverse_iterator<Traversal>
+        crend() const noexcept
+        { return const_reverse_iterator<Traversal>(this->cend<Traversal>()); }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name modifiers
+         * @{
+         */
+
+        /**
+         * @brief constructs a new node in child-slot `slot` of `where`.
+         * @param where an iterator to the new node's parent, end() for a top-level node.
+         * @return an iterator to the newly created node.
+         * @note exceptions are thrown / behaviour is undefined if:
+         * - `slot` is not smaller than `Size`.
+         * - the slot is already occupied.
+         */
+        template <traversal Traversal = default_traversal, typename... Args>
+            requires std::constructible_from<value_type, Args&&...>
+        iterator<Traversal>
+        emplace(iterator<Traversal> where, std::size_t slot, Args&&... args)
+        {
+            if constexpr (Policy::exceptions)
+            {
+                if (slot >= Size) { throw std::out_of_range("child-slot out of range"); }
+                if (where.node_ptr_M_()->children_M_[slot]) { throw std::invalid_argument("child-slot is already occupied"); }
+            }
+            else
+            { assert(slot < Size && !where.node_ptr_M_()->children_M_[slot]); }
+            node_ptr_T_ new__ = this->impl_M_.get_node_M_(std::forward<Args>(args)...);
+            new__->hook_M_(where.node_ptr_M_(), slot);
+            ++this->impl_M_.header_M_.size_M_;
+            return iterator<Traversal>(new__);
+        }
+
+        /**
+         * @brief inserts a copy of `value` in child-slot `slot` of `where`. see emplace().
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        insert(iterator<Traversal> where, std::size_t slot, const value_type& value)
+        { return this->emplace(where, slot, value); }
+
+        /**
+         * @brief moves `value` into child-slot `slot` of `where`. see emplace().
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        insert(iterator<Traversal> where, std::size_t slot, value_type&& value)
+        { return this->emplace(where, slot, std::move(value)); }
+
+        /**
+         * @brief erases the node `where` points to, including all of it's descendants, and empties it's slot.
+         * @return an iterator to the node that followed `where`'s subtree in `Traversal`-order.
+         * @note exceptions are thrown / the behaviour is undefined if:
+         * - `where` is an `end()`-iterator.
+         */
+        template <traversal Traversal = default_traversal>
+        iterator<Traversal>
+        erase(iterator<Traversal> where) noexcept(!Policy::exceptions && Traversal != breadth_first_in_order && Traversal != breadth_first_reverse_order)
+        {
+            base_ptr_T_ node__{where.node_ptr_M_()};
+            if constexpr (Policy::exceptions)
+            { if (node__->is_root_M_()) { throw std::invalid_argument("'where' cannot point to the root-node"); } }
+            else
+            { assert(!node__->is_root_M_()); }
+
+            base_ptr_T_ next__{nullptr};
+            if constexpr (Traversal == depth_first_pre_order)
+            { next__ = node_base_T_::skip_subtree_M_(node__); }
+            else
+            {
+                iterator<Traversal> iter__{std::next(where)};
+                while (iter__.node_ptr_M_()->is_in_subtree_of_M_(node__)) /* skip the descendants */
+                { ++iter__; }
+                next__ = iter__.node_ptr_M_();
+            }
+            node__->unhook_M_();
+            this->impl_M_.header_M_.size_M_ -= this->destroy_subtree_M_(node__);
+            return iterator<Traversal>(next__);
+        }
+
+        /**
+         * @brief erases every node in the tree.
+         */
+        void
+        clear() noexcept
+        {
+            for (base_ptr_T_ child__ : this->impl_M_.header_M_.children_M_)
+            { if (child__) { this->destroy_subtree_M_(child__); } }
+            this->impl_M_.header_M_.reset_M_();
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @name container-information
+         * @{
+         */
+
+        /**
+         * @return the depth of the deepest node in the tree.
+         */
+        std::size_t
+        maximum_depth() const noexcept
+        {
+            std::size_t res__{0ull};
+            c_base_ptr_T_ header__{&this->impl_M_.header_M_};
+            if (!header__->has_children_M_())
+            { return res__; }
+            c_base_ptr_T_ iter__{header__->first_child_M_()};
+            std::size_t depth__{1ull};
+            while (true)
+            {
+                res__ = std::max(res__, depth__);
+                if (iter__->has_children_M_())
+                { iter__ = iter__->first_child_M_(); ++depth__; continue; }
+                while (iter__->is_last_child_M_())
+                {
+                    iter__ = iter__->parent_M_; --depth__;
+                    if (iter__ == header__) { return res__; }
+                }
+                iter__ = iter__->next_sibling_M_();
+            }
+        }
+
+        /**
+         * @brief get the associated allocator object.
+         * @return instance of `allocator_type`
+         */
+        allocator_type
+        get_allocator() const noexcept
+        { return allocator_type(this->impl_M_.get_node_alloc_M_()); }
+
+        /**
+         * @return the total node-count of the tree.
+         */
+        std::size_t
+        size() const noexcept
+        { return this->impl_M_.header_M_.size_M_; }
+
+        /**
+         * @return true if the tree is empty.
+         */
+        bool
+        empty() const noexcept
+        { return !this->impl_M_.header_M_.size_M_; }
+
+        /**
+         * @}
+         */
+
+    protected:
+
+        /**
+         * destroys node__ and all of it's descendants in post-order, without recursion.
+         * expects node__ to be unhooked or it's parent to be reset by the caller.
+         * @return the number of destroyed nodes.
+         */
+        std::size_t
+        destroy_subtree_M_(base_ptr_T_ node__) noexcept
+        {
+            std::size_t nodes_affected__{0ull};
+            base_ptr_T_ iter__{node_base_T_::leftmost_M_(node__)};
+            while (true)
+            {
+                bool last__{iter__ == node__};
+                base_ptr_T_ next__{nullptr};
+                if (!last__) /* the parent is destroyed after all of it's children, it's slots stay readable until then */
+                {
+                    base_ptr_T_ sibling__{iter__->next_sibling_M_()};
+                    next__ = sibling__ ? node_base_T_::leftmost_M_(sibling__) : iter__->parent_M_;
+                }
+                this->impl_M_.put_node_M_(static_cast<node_ptr_T_>(iter__));
+                ++nodes_affected__;
+                if (last__) { return nodes_affected__; }
+                iter__ = next__;
+            }
+        }
+
+        /* walks other__ in pre-order and hooks a copy of every node into the same slot, without recursion */
+        void
+        copy_from_M_(const n_ary_tree& other__)
+        {
+            c_base_ptr_T_ header__{&other__.impl_M_.header_M_};
+            if (!header__->has_children_M_())
+            { return; }
+            c_base_ptr_T_ iter__{header__->first_child_M_()};
+            base_ptr_T_ parent__{&this->impl_M_.header_M_};
+            while (true)
+            {
+                node_ptr_T_ new__ = this->impl_M_.get_node_M_(static_cast<c_node_ptr_T_>(iter__)->value_M_);
+                new__->hook_M_(parent__, iter__->slot_M_);
+                ++this->impl_M_.header_M_.size_M_;
+                if (iter__->has_children_M_())
+                { iter__ = iter__->first_child_M_(); parent__ = new__; continue; }
+
+                base_ptr_T_ copy__{new__}; /* the copy of iter__ */
+                while (iter__->is_last_child_M_())
+                {
+                    iter__ = iter__->parent_M_; copy__ = copy__->parent_M_;
+                    if (iter__ == header__) { return; }
+                }
+                iter__ = iter__->next_sibling_M_();
+                parent__ = copy__->parent_M_;
+            }
+        }
+
+        void
+        from_initializer_list_M_(base_ptr_T_ parent__, std::initializer_list<initializer_type> ilist__)
+        {
+            if constexpr (Policy::exceptions)
+            { if (ilist__.size() > Size) { throw std::length_error("more child-nodes than child-slots in initializer-list"); } }
+            else
+            { assert(ilist__.size() <= Size); }
+            std::size_t slot__{0ull};
+            for (const initializer_type& init__ : ilist__)
+            {
+                node_ptr_T_ new__ = init__.make_node_M_(this->impl_M_.get_node_alloc_M_());
+                new__->hook_M_(parent__, slot__++);
+                ++this->impl_M_.header_M_.size_M_;
+                if (init__.children_M_.size())
+                { this->from_initializer_list_M_(new__, init__.children_M_); }
+            }
+        }
 
+        n_ary_tree_impl__ impl_M_;
     };
 
 }
 
-#endif
\ No newline at end of file
+#endif
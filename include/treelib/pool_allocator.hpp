@@ -0,0 +1,381 @@
+/********************************/
+#ifndef TRL_POOL_ALLOCATOR_HPP
+#define TRL_POOL_ALLOCATOR_HPP
+/********************************/
+/**
+ * @file    pool_allocator.hpp
+ * @date    16/10/2026
+ *
+ * @brief
+ * slab-allocator for node-based containers such as trl::flex_tree.
+ *
+ * @details
+ * trl::pool_allocator hands out single objects from large contiguous blocks instead of
+ * requesting every node separately from the global heap. freed objects are kept in an
+ * intrusive free-list and reused before the next block is touched, so building and tearing down
+ * a tree mostly becomes pointer-bumping. nodes that were created one after another only end up next to each other
+ * in memory while the free-list is empty. reserve_sequential() hands out the next objects from one contiguous
+ * block regardless, which trl::flex_tree::compact() uses to lay out it's nodes in traversal-order.
+ *
+ * all copies of an allocator, including rebound copies, share the same pool. a default-constructed
+ * allocator creates a new pool, which lives until the last allocator referring to it is destroyed.
+ * to let several trees share one pool, construct them from copies of the same allocator:
+ *
+ * @code
+ * trl::pool_allocator<int> pool;
+ * trl::flex_tree<int, trl::pool_allocator<int>> a(pool), b(pool);
+ * @endcode
+ *
+ * single objects are pooled by size-class: objects that round up to the same chunk-size and alignment
+ * share blocks and a free-list, objects of other sizes get their own, so e.g. the nodes of trees with
+ * different value-types never mix. allocations of several objects at once are forwarded to the global
+ * operator new.
+ *
+ * pools are not thread-safe, just like the containers using them.
+ */
+/********************************/
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <algorithm>
+/********************************/
+
+namespace trl
+{
+
+    namespace detail__
+    {
+        /**
+         * @brief
+         * the pool shared by all copies of a pool_allocator.
+         * keeps a separate set of blocks and free-list for every size-class of the objects allocated from it.
+         */
+        class pool_resource__
+        {
+        public:
+
+            explicit pool_resource__(std::size_t max_chunks_per_block__) noexcept
+                : max_chunks_per_block_M_(max_chunks_per_block__)
+            { }
+
+            /* non-copyable, always shared through the allocators */
+            pool_resource__(const pool_resource__&) = delete;
+            pool_resource__& operator=(const pool_resource__&) = delete;
+
+            ~pool_resource__()
+            {
+                while (this->classes_M_)
+                {
+                    size_class__* next__ = this->classes_M_->next_M_;
+                    this->classes_M_->release_blocks_M_();
+                    delete this->classes_M_;
+                    this->classes_M_ = next__;
+                }
+            }
+
+            void*
+            allocate_M_(std::size_t size__, std::size_t align__)
+            {
+                size_class__* class__ = this->find_or_add_M_(size__, align__);
+                if (class__->sequential_M_)
+                { --class__->sequential_M_; }
+                else if (class__->free_M_)
+                {
+                    free_chunk__* chunk__ = class__->free_M_;
+                    class__->free_M_ = chunk__->next_M_;
+                    ++class__->chunks_in_use_M_;
+                    return chunk__;
+                }
+                if (class__->cursor_M_ == class__->end_M_)
+                { class__->grow_M_(this->max_chunks_per_block_M_); }
+                ++class__->chunks_in_use_M_;
+                void* chunk__ = class__->cursor_M_;
+                class__->cursor_M_ += class__->chunk_size_M_;
+                return chunk__;
+            }
+
+            /* expects `ptr__` to be allocated through allocate_M_() with the same size and alignment */
+            void
+            deallocate_M_(void* ptr__, std::size_t size__, std::size_t align__) noexcept
+            {
+                size_class__* class__ = this->find_M_(size__, align__);
+                --class__->chunks_in_use_M_;
+                class__->free_M_ = ::new (ptr__) free_chunk__{class__->free_M_};
+            }
+
+            /**
+             * @brief 
+             * the next `count__` allocations of a size-class bump through one contiguous range, skipping the free-list.
+             * grows a block of at least `count__` chunks if the current one has less room left, the rest of the current
+             * block is put on the free-list instead of being abandoned. 0 returns to the free-list.
+             */
+            void
+            reserve_sequential_M_(std::size_t size__, std::size_t align__, std::size_t count__)
+            {
+                size_class__* class__ = this->find_or_add_M_(size__, align__);
+                if (count__ > static_cast<std::size_t>(class__->end_M_ - class__->cursor_M_) / class__->chunk_size_M_)
+                {
+                    class__->free_tail_M_();
+                    class__->grow_M_(this->max_chunks_per_block_M_, count__);
+                }
+                class__->sequential_M_ = count__;
+            }
+
+            /**
+             * @brief returns every block of a size-class to the global heap at once, all chunks handed out of it become invalid.
+             */
+            void
+            release_M_(std::size_t size__, std::size_t align__) noexcept
+            {
+                if (size_class__* class__ = this->find_M_(size__, align__))
+                { class__->release_blocks_M_(); }
+            }
+
+            /**
+             * @return the number of chunks of a size-class that are currently handed out.
+             */
+            std::size_t
+            in_use_M_(std::size_t size__, std::size_t align__) const noexcept
+            {
+                const size_class__* class__ = this->find_M_(size__, align__);
+                return class__ ? class__->chunks_in_use_M_ : 0ull;
+            }
+
+            /**
+             * @return the size of the chunks objects of `size__` and `align__` are allocated in.
+             */
+            static constexpr std::size_t
+            chunk_size_of_M_(std::size_t size__, std::size_t align__) noexcept
+            {
+                std::size_t chunk_align__ = chunk_align_of_M_(align__);
+                return (std::max(size__, sizeof(free_chunk__)) + chunk_align__ - 1) / chunk_align__ * chunk_align__;
+            }
+
+        private:
+
+            /* the first bytes of every freed chunk link it to the next freed chunk */
+            struct free_chunk__
+            { free_chunk__* next_M_; };
+
+            /* prepended to every block, blocks are released in one pass on destruction */
+            struct block__
+            {
+                block__* next_M_;
+                std::size_t bytes_M_;
+            };
+
+            static constexpr std::size_t
+            chunk_align_of_M_(std::size_t align__) noexcept
+            { return std::max(align__, alignof(free_chunk__)); }
+
+            /* blocks and free-list for all objects that round up to the same chunk-size and alignment */
+            struct size_class__
+            {
+                size_class__(std::size_t chunk_size__, std::size_t chunk_align__, size_class__* next__) noexcept
+                    : chunk_size_M_(chunk_size__), chunk_align_M_(chunk_align__), next_M_(next__)
+                { }
+
+                void
+                grow_M_(std::size_t max_chunks_per_block__, std::size_t min_chunks__ = 1ull)
+                {
+                    /* blocks double in size, so small pools stay small and large pools need few blocks */
+                    std::size_t chunks__ = this->blocks_M_ ? std::min(this->last_chunks_M_ * 2, max_chunks_per_block__) : initial_chunks_per_block;
+                    chunks__ = std::max(chunks__, min_chunks__);
+                    std::size_t align__ = std::max(this->chunk_align_M_, alignof(block__));
+                    std::size_t offset__ = (sizeof(block__) + align__ - 1) / align__ * align__;
+                    std::size_t bytes__ = offset__ + chunks__ * this->chunk_size_M_;
+
+                    std::byte* memory__ = static_cast<std::byte*>(::operator new(bytes__, std::align_val_t{align__}));
+                    this->blocks_M_ = ::new (memory__) block__{this->blocks_M_, bytes__};
+                    this->cursor_M_ = memory__ + offset__;
+                    this->end_M_ = this->cursor_M_ + chunks__ * this->chunk_size_M_;
+                    this->last_chunks_M_ = chunks__;
+                }
+
+                /* puts the chunks of the current block that were never handed out on the free-list */
+                void
+                free_tail_M_() noexcept
+                {
+                    while (this->end_M_ != this->cursor_M_)
+                    {
+                        this->end_M_ -= this->chunk_size_M_;
+                        this->free_M_ = ::new (static_cast<void*>(this->end_M_)) free_chunk__{this->free_M_};
+                    }
+                }
+
+                void
+                release_blocks_M_() noexcept
+                {
+                    std::size_t align__ = std::max(this->chunk_align_M_, alignof(block__));
+                    while (this->blocks_M_)
+                    {
+                        block__* next__ = this->blocks_M_->next_M_;
+                        ::operator delete(static_cast<void*>(this->blocks_M_), std::align_val_t{align__});
+                        this->blocks_M_ = next__;
+                    }
+                    this->cursor_M_ = this->end_M_ = nullptr;
+                    this->free_M_ = nullptr;
+                    this->chunks_in_use_M_ = 0ull;
+                    this->sequential_M_ = 0ull;
+                }
+
+                std::size_t chunk_size_M_;
+                std::size_t chunk_align_M_;
+                size_class__* next_M_;
+                std::size_t last_chunks_M_{0ull};
+                std::size_t chunks_in_use_M_{0ull};
+                std::size_t sequential_M_{0ull}; /* allocations left that skip the free-list, see reserve_sequential_M_() */
+                block__* blocks_M_{nullptr};
+                std::byte* cursor_M_{nullptr};
+                std::byte* end_M_{nullptr};
+                free_chunk__* free_M_{nullptr};
+            };
+
+            /* the size-class of objects of `size__` and `align__`, nullptr if nothing of it was allocated yet */
+            size_class__*
+            find_M_(std::size_t size__, std::size_t align__) const noexcept
+            {
+                std::size_t chunk_size__ = chunk_size_of_M_(size__, align__);
+                std::size_t chunk_align__ = chunk_align_of_M_(align__);
+                /* containers mostly allocate one type, so the last size-class is checked first */
+                if (this->last_M_ && this->last_M_->chunk_size_M_ == chunk_size__ && this->last_M_->chunk_align_M_ == chunk_align__)
+                { return this->last_M_; }
+                for (size_class__* class__ = this->classes_M_; class__; class__ = class__->next_M_)
+                {
+                    if (class__->chunk_size_M_ == chunk_size__ && class__->chunk_align_M_ == chunk_align__)
+                    { this->last_M_ = class__; return class__; }
+                }
+                return nullptr;
+            }
+
+            size_class__*
+            find_or_add_M_(std::size_t size__, std::size_t align__)
+            {
+                size_class__* class__ = this->find_M_(size__, align__);
+                if (!class__)
+                { class__ = this->classes_M_ = new size_class__(chunk_size_of_M_(size__, align__), chunk_align_of_M_(align__), this->classes_M_); }
+                this->last_M_ = class__;
+                return class__;
+            }
+
+            static constexpr std::size_t initial_chunks_per_block = 32ull;
+
+            std::size_t max_chunks_per_block_M_;
+            size_class__* classes_M_{nullptr};
+            mutable size_class__* last_M_{nullptr};
+        };
+    }
+
+    /**
+     * @brief slab-allocator handing out single objects from a shared pool of contiguous blocks.
+     * @tparam Type the type of the allocated objects.
+     * @tparam MaxChunksPerBlock upper bound for the number of objects per block, blocks grow up to this size.
+     */
+    template <typename Type, std::size_t MaxChunksPerBlock = 4096ull>
+    class pool_allocator
+    {
+    public:
+
+        using value_type = Type;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        template <typename Other>
+        struct rebind
+        { using other = pool_allocator<Other, MaxChunksPerBlock>; };
+
+        /**
+         * @brief creates a new, empty pool.
+         */
+        pool_allocator()
+            : pool_M_(std::make_shared<detail__::pool_resource__>(MaxChunksPerBlock))
+        { }
+
+        pool_allocator(const pool_allocator&) noexcept = default;
+        pool_allocator& operator=(const pool_allocator&) noexcept = default;
+
+        /**
+         * @brief shares the pool of an allocator for another type.
+         */
+        template <typename Other>
+        pool_allocator(const pool_allocator<Other, MaxChunksPerBlock>& other) noexcept
+            : pool_M_(other.pool_M_)
+        { }
+
+        [[nodiscard]]
+        Type*
+        allocate(std::size_t count)
+        {
+            if (count == 1ull)
+            { return static_cast<Type*>(this->pool_M_->allocate_M_(sizeof(Type), alignof(Type))); }
+            return static_cast<Type*>(::operator new(count * sizeof(Type), std::align_val_t{alignof(Type)}));
+        }
+
+        void
+        deallocate(Type* ptr, std::size_t count) noexcept
+        {
+            if (count == 1ull)
+            { this->pool_M_->deallocate_M_(ptr, sizeof(Type), alignof(Type)); }
+            else
+            { ::operator delete(ptr, std::align_val_t{alignof(Type)}); }
+        }
+
+        /**
+         * @brief
+         * hands out the next `count` single objects of the size-class of `Type` one after another from one contiguous range,
+         * at increasing addresses `chunk_size()` apart, instead of reusing freed objects first. `count = 0` ends this early.
+         * if the current block has no room for `count` objects, a new one is allocated and the rest of the current block
+         * is reused like freed objects, so repeated calls don't waste blocks.
+         * trl::flex_tree::compact() uses this to lay out it's nodes in traversal-order.
+         * @note throws std::bad_alloc if a new block for `count` objects can not be allocated.
+         */
+        void
+        reserve_sequential(std::size_t count)
+        { this->pool_M_->reserve_sequential_M_(sizeof(Type), alignof(Type), count); }
+
+        /**
+         * @brief
+         * frees every block of the size-class of `Type` at once, without destroying the objects in it.
+         * all objects of that size-class allocated from the pool (through any copy of this allocator) become invalid,
+         * objects of other sizes are not affected.
+         * trl::flex_tree uses this to drop all of it's nodes in one step, see flex_tree::clear().
+         */
+        void
+        release() noexcept
+        { this->pool_M_->release_M_(sizeof(Type), alignof(Type)); }
+
+        /**
+         * @return the number of single objects of the size-class of `Type` currently allocated from the shared pool.
+         */
+        std::size_t
+        pooled_objects() const noexcept
+        { return this->pool_M_->in_use_M_(sizeof(Type), alignof(Type)); }
+
+        /**
+         * @return the size of the chunks single objects of `Type` are pooled in. objects of the same chunk-size share blocks.
+         */
+        static constexpr std::size_t
+        chunk_size() noexcept
+        { return detail__::pool_resource__::chunk_size_of_M_(sizeof(Type), alignof(Type)); }
+
+        template <typename Other>
+        friend bool
+        operator==(const pool_allocator& a, const pool_allocator<Other, MaxChunksPerBlock>& b) noexcept
+        { return a.pool_M_ == b.pool_M_; }
+
+    private:
+
+        template <typename, std::size_t>
+        friend class pool_allocator;
+
+        std::shared_ptr<detail__::pool_resource__> pool_M_;
+    };
+
+}
+
+#endif
@@ -6,6 +6,7 @@
 namespace py = pybind11;
 
 using flex_tree = trl::flex_tree<py::object, std::allocator<py::object>>;
+using iterator = flex_tree::iterator<trl::depth_first_pre_order>;
 
 PYBIND11_MODULE(treelib, m, py::mod_gil_not_used())
 {
@@ -13,6 +14,6 @@ PYBIND11_MODULE(treelib, m, py::mod_gil_not_used())
     
     py::class_<flex_tree>(m,"FlexTree")
         .def(py::init<>())
-        .def("append", &flex_tree::append<trl::depth_first_pre_order>)
-        .def("prepend", &flex_tree::prepend<trl::depth_first_pre_order>);
+        .def("append", py::overload_cast<iterator, const py::object&>(&flex_tree::append<trl::depth_first_pre_order>))
+        .def("prepend", py::overload_cast<iterator, const py::object&>(&flex_tree::prepend<trl::depth_first_pre_order>));
 }
@@ -0,0 +1,88 @@
+# runs every benchmark of the compile-option matrix and prints a comparison-table of ns/op.
+# invoked by the 'treelib_benchmark_matrix' target with:
+# - BENCHMARKS : '|'-separated paths to the benchmark executables.
+# - ARGS       : '|'-separated arguments passed to every benchmark.
+
+cmake_minimum_required(VERSION 3.30.0)
+
+string(REPLACE "|" ";" benchmarks "${BENCHMARKS}")
+string(REPLACE "|" ";" args "${ARGS}")
+
+# left-aligns 'text' in a column of 'width' characters.
+function(pad_column out text width)
+    string(LENGTH "${text}" length)
+    while (length LESS width)
+        string(APPEND text " ")
+        math(EXPR length "${length} + 1")
+    endwhile()
+    set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+set(configs)
+set(rows)
+foreach (benchmark IN LISTS benchmarks)
+    message(STATUS "running ${benchmark}")
+    execute_process(COMMAND ${benchmark} ${args} --csv
+        OUTPUT_VARIABLE output
+        RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${benchmark} failed: ${result}")
+    endif()
+
+    string(REPLACE "\n" ";" lines "${output}")
+    foreach (line IN LISTS lines)
+        if (line STREQUAL "" OR line MATCHES "^config,")
+            continue()
+        endif()
+        # config,shape,nodes,operation,ops,ns_per_op,nodes_per_s,peak_rss_bytes
+        string(REPLACE "," ";" fields "${line}")
+        list(GET fields 0 config)
+        list(GET fields 1 shape)
+        list(GET fields 2 nodes)
+        list(GET fields 3 operation)
+        list(GET fields 5 ns_per_op)
+        set(row "${shape}/${nodes}/${operation}")
+        if (NOT row IN_LIST rows)
+            list(APPEND rows "${row}")
+        endif()
+        if (NOT config IN_LIST configs)
+            list(APPEND configs "${config}")
+        endif()
+        set("result_${config}/${row}" "${ns_per_op}")
+    endforeach()
+endforeach()
+
+message("")
+message("ns/op per compile-option configuration (fd = TRL_FLEX_TREE_FAST_DEPTH, nr = TRL_FLEX_TREE_NO_RECURSION, ne = TRL_FLEX_TREE_NOEXCEPT)")
+pad_column(header "shape" 13)
+pad_column(column "nodes" 10)
+string(APPEND header "${column}")
+pad_column(column "operation" 24)
+string(APPEND header "${column}")
+foreach (config IN LISTS configs)
+    pad_column(column "${config}" 14)
+    string(APPEND header "${column}")
+endforeach()
+message("${header}")
+
+foreach (row IN LISTS rows)
+    string(REPLACE "/" ";" row_fields "${row}")
+    list(GET row_fields 0 shape)
+    list(GET row_fields 1 nodes)
+    list(GET row_fields 2 operation)
+    pad_column(line "${shape}" 13)
+    pad_column(column "${nodes}" 10)
+    string(APPEND line "${column}")
+    pad_column(column "${operation}" 24)
+    string(APPEND line "${column}")
+    foreach (config IN LISTS configs)
+        if (DEFINED "result_${config}/${row}")
+            set(value "${result_${config}/${row}}")
+        else()
+            set(value "-")
+        endif()
+        pad_column(column "${value}" 14)
+        string(APPEND line "${column}")
+    endforeach()
+    message("${line}")
+endforeach()
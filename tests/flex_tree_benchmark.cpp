@@ -1,6 +1,617 @@
+/**
+ * @file    flex_tree_benchmark.cpp
+ *
+ * @brief
+ * benchmark-suite for trl::flex_tree.
+ *
+ * @details
+ * generates trees of different shapes (deep-chain, wide-fanout, balanced and random)
+ * and times construction, iteration, concatenation, splicing and erasure on them for
+ * node-counts growing by a factor of 10 from --min-nodes to --max-nodes.
+ * iteration is timed once more on a trl::flat_flex_tree flattened from the same tree.
+ * every row reports the time per operation, the throughput in nodes per second and the
+ * peak resident-set-size of the process while that shape and node-count was benchmarked.
+ *
+ * operations that are expected to take longer than --budget seconds on the next node-count
+ * (extrapolated from the last two measurements) are skipped for the rest of that shape,
+ * so the table shows where the structure stops scaling without running for hours.
+ *
+ * --allocator pool runs the same workload on trees using trl::pool_allocator instead of std::allocator.
+ * --links siblings runs it on trees that only link siblings (trl::flex_tree_policy::layer_links = false),
+ * --links forward additionally leaves out prev-, last-child-links and child-counts of every node.
+ *
+ * usage:
+ * treelib_benchmarks [--min-nodes N] [--max-nodes N] [--shape NAME]... [--budget SECONDS] [--allocator NAME] [--links NAME] [--csv]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/resource.h>
+#endif
+
+#include "../include/treelib/flex_tree.hpp"
+#include "../include/treelib/pool_allocator.hpp"
+#include "../include/treelib/flat_flex_tree.hpp"
+
+#ifndef TRL_BENCHMARK_CONFIG
+    #define TRL_BENCHMARK_CONFIG "default"
+#endif
+
+namespace
+{
+    using value_type = std::uint64_t;
+    using clock_type = std::chrono::steady_clock;
+
+    constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    constexpr std::size_t balanced_arity = 4;
+    constexpr std::size_t max_batch_ops = 100000;
+    /* copying recurses once per depth-layer (unless the policy sets no_recursion), deeper chains would overflow the stack. */
+    constexpr std::size_t max_recursion_depth = 10000;
+
+    /**
+     * @name peak resident-set-size.
+     * on linux the high-water-mark can be reset through /proc/self/clear_refs,
+     * elsewhere the process-wide maximum is reported.
+     * @{
+     */
+
+    void
+    reset_peak_rss()
+    {
+    #ifdef __linux__
+        std::ofstream clear_refs("/proc/self/clear_refs");
+        if (clear_refs) { clear_refs << "5"; }
+    #endif
+    }
+
+    std::size_t
+    peak_rss_bytes()
+    {
+    #ifdef __linux__
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.rfind("VmHWM:", 0) == 0)
+            { return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024ull; }
+        }
+    #endif
+    #if defined(__unix__) || defined(__APPLE__)
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        #ifdef __APPLE__
+        return static_cast<std::size_t>(usage.ru_maxrss);
+        #else
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024ull;
+        #endif
+    #else
+        return 0ull;
+    #endif
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @brief
+     * a tree-shape described by the parent-index of every node in creation-order.
+     * node 0 is the only top-level node, every other node's parent was created before it.
+     */
+    struct shape
+    {
+        std::string name;
+        std::vector<std::size_t> parents;
+    };
+
+    shape
+    make_shape(const std::string& name, std::size_t nodes)
+    {
+        shape res{name, std::vector<std::size_t>(nodes)};
+        std::mt19937_64 rng(nodes);
+        res.parents[0] = npos;
+        for (std::size_t i = 1; i < nodes; ++i)
+        {
+            if (name == "deep_chain") { res.parents[i] = i - 1; }
+            else if (name == "wide_fanout") { res.parents[i] = 0; }
+            else if (name == "balanced") { res.parents[i] = (i - 1) / balanced_arity; }
+            else { res.parents[i] = std::uniform_int_distribution<std::size_t>(0, i - 1)(rng); }
+        }
+        return res;
+    }
+
+    enum class build_method { append, prepend, insert_after };
+
+    /**
+     * @brief builds `s` into an empty tree, also collects iterators to every node.
+     */
+    template <typename Tree>
+    void
+    build(Tree& tree, const shape& s, build_method method, 
+          std::vector<typename Tree::template iterator<trl::depth_first_pre_order>>& nodes)
+    {
+        using iterator_type = typename Tree::template iterator<trl::depth_first_pre_order>;
+        const std::size_t count = s.parents.size();
+        nodes.resize(count);
+        std::vector<iterator_type> last_child;
+        if (method == build_method::insert_after)
+        { last_child.assign(count, tree.end()); }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            iterator_type parent = (s.parents[i] == npos) ? tree.end() : nodes[s.parents[i]];
+            switch (method)
+            {
+            case build_method::append:
+                nodes[i] = tree.append(parent, i);
+                break;
+            case build_method::prepend:
+                nodes[i] = tree.prepend(parent, i);
+                break;
+            case build_method::insert_after:
+            {
+                std::size_t slot = (s.parents[i] == npos) ? 0 : s.parents[i];
+                if (last_child[slot] == tree.end()) { nodes[i] = tree.append(parent, i); }
+                else { nodes[i] = tree.insert_after(last_child[slot], i); }
+                last_child[slot] = nodes[i];
+                break;
+            }
+            }
+        }
+    }
+
+    /**
+     * @brief
+     * leaves of the freshly built shape are the sources for splicing and erasing.
+     * they are only ever moved below or next to inner nodes, so they stay leaves
+     * and splicing them can never violate the 'where is not a child of src' precondition.
+     */
+    void
+    split_leaves(const shape& s, std::vector<std::size_t>& leaves, std::vector<std::size_t>& inner)
+    {
+        std::vector<bool> has_children(s.parents.size(), false);
+        for (std::size_t parent : s.parents)
+        { if (parent != npos) { has_children[parent] = true; } }
+        for (std::size_t i = 0; i < s.parents.size(); ++i)
+        { (has_children[i] ? inner : leaves).push_back(i); }
+    }
+
+    struct measurement
+    {
+        std::string operation;
+        std::size_t ops{0ull};
+        std::size_t nodes{0ull};
+        double seconds{0.0};
+    };
+
+    template <typename Function>
+    measurement
+    time_it(std::string operation, std::size_t ops, std::size_t nodes, Function&& function)
+    {
+        clock_type::time_point start = clock_type::now();
+        function();
+        std::chrono::duration<double> elapsed = clock_type::now() - start;
+        return measurement{std::move(operation), ops, nodes, elapsed.count()};
+    }
+
+    struct options
+    {
+        std::size_t min_nodes{1000ull};
+        std::size_t max_nodes{10000000ull};
+        double budget{10.0};
+        bool csv{false};
+        std::string allocator{"std"};
+        std::string links{"layers"};
+        std::string config{TRL_BENCHMARK_CONFIG};
+        std::vector<std::string> shapes;
+    };
+
+    template <typename Tree>
+    class benchmark
+    {
+    public:
+
+        using tree_type = Tree;
+        using iterator_type = typename tree_type::template iterator<trl::depth_first_pre_order>;
+
+        explicit benchmark(const options& opts)
+            : opts_(opts)
+        { }
+
+        void
+        run()
+        {
+            if (this->opts_.csv)
+            { std::printf("config,shape,nodes,operation,ops,ns_per_op,nodes_per_s,peak_rss_bytes\n"); }
+            else
+            {
+                std::printf("flex_tree benchmark (config: %s)\n", this->opts_.config.c_str());
+                std::printf("%-12s %10s  %-26s %9s %12s %12s %12s\n",
+                    "shape", "nodes", "operation", "ops", "ns/op", "nodes/s", "peak-RSS");
+            }
+            for (const std::string& name : this->opts_.shapes)
+            {
+                this->history_.clear();
+                for (std::size_t nodes = this->opts_.min_nodes; nodes <= this->opts_.max_nodes; nodes *= 10)
+                { this->run_case(name, nodes); }
+            }
+        }
+
+    private:
+
+        /**
+         * @return true if `operation` is expected to stay within the budget for `nodes`.
+         */
+        bool
+        within_budget(const std::string& operation, std::size_t nodes)
+        {
+            auto found = this->history_.find(operation);
+            if (found == this->history_.end())
+            { return true; }
+            const std::vector<std::pair<std::size_t, double>>& runs = found->second;
+            if (runs.back().second < 0.0)
+            { return false; } /* already skipped once */
+            double growth = static_cast<double>(nodes) / static_cast<double>(runs.back().first);
+            if (runs.size() > 1 && runs[runs.size() - 2].second > 0.0)
+            { growth = std::max(growth, runs.back().second / runs[runs.size() - 2].second); }
+            return runs.back().second * growth <= this->opts_.budget;
+        }
+
+        void
+        report(const std::string& shape_name, std::size_t nodes, const measurement& m)
+        {
+            this->history_[m.operation].emplace_back(nodes, m.seconds);
+            double ns_per_op = m.ops ? m.seconds * 1e9 / static_cast<double>(m.ops) : 0.0;
+            double nodes_per_s = m.seconds > 0.0 ? static_cast<double>(m.nodes) / m.seconds : 0.0;
+            std::size_t rss = peak_rss_bytes();
+            if (this->opts_.csv)
+            {
+                std::printf("%s,%s,%zu,%s,%zu,%.3f,%.6g,%zu\n", this->opts_.config.c_str(),
+                    shape_name.c_str(), nodes, m.operation.c_str(), m.ops, ns_per_op, nodes_per_s, rss);
+            }
+            else
+            {
+                std::printf("%-12s %10zu  %-26s %9zu %12.2f %12.4g %9.1f MiB\n",
+                    shape_name.c_str(), nodes, m.operation.c_str(), m.ops, ns_per_op, nodes_per_s,
+                    static_cast<double>(rss) / (1024.0 * 1024.0));
+            }
+            std::fflush(stdout);
+        }
+
+        /**
+         * @brief prints a share (0 to 1) measured on the tree instead of a time, only in the table.
+         */
+        void
+        report_share(const std::string& shape_name, std::size_t nodes, const std::string& operation, double share)
+        {
+            if (!this->opts_.csv)
+            { std::printf("%-12s %10zu  %-26s %9zu %12s %12.3f\n", shape_name.c_str(), nodes, operation.c_str(), nodes, "-", share); }
+        }
+
+        /**
+         * @return the share of nodes that lie directly behind their pre-order predecessor in memory,
+         *         at most two node-sizes further (allowing for the headers of general-purpose allocators).
+         */
+        static double
+        locality(const tree_type& tree)
+        {
+            using node_type = trl::detail__::flex_tree_node__<value_type, typename tree_type::policy_type>;
+            std::size_t adjacent = 0;
+            std::uintptr_t last = 0;
+            for (typename tree_type::template const_iterator<trl::depth_first_pre_order> it = tree.cbegin(); it != tree.cend(); ++it)
+            {
+                std::uintptr_t address = reinterpret_cast<std::uintptr_t>(it.node_ptr_M_());
+                if (last && address > last && address - last <= 2 * sizeof(node_type)) { ++adjacent; }
+                last = address;
+            }
+            return tree.size() > 1 ? static_cast<double>(adjacent) / static_cast<double>(tree.size() - 1) : 1.0;
+        }
+
+        void
+        skip(const std::string& shape_name, std::size_t nodes, const std::string& operation, const char* reason)
+        {
+            this->history_[operation].emplace_back(nodes, -1.0);
+            if (!this->opts_.csv)
+            { std::printf("%-12s %10zu  %-26s %9s   skipped (%s)\n", shape_name.c_str(), nodes, operation.c_str(), "-", reason); }
+        }
+
+        /**
+         * @brief times `function` if the budget allows it, otherwise records the operation as skipped.
+         */
+        template <typename Function>
+        void
+        measure(const std::string& shape_name, std::size_t nodes, const std::string& operation,
+                std::size_t ops, std::size_t nodes_affected, Function&& function)
+        {
+            if (!this->within_budget(operation, nodes))
+            { this->skip(shape_name, nodes, operation, "over budget"); return; }
+            this->report(shape_name, nodes, time_it(operation, ops, nodes_affected, std::forward<Function>(function)));
+        }
+
+        void
+        run_case(const std::string& shape_name, std::size_t nodes)
+        {
+            reset_peak_rss();
+            if (!tree_type::policy_type::no_recursion && shape_name == "deep_chain" && nodes > max_recursion_depth)
+            { this->skip(shape_name, nodes, "*", "recursion depth, build with TRL_FLEX_TREE_NO_RECURSION"); return; }
+            if (!this->within_budget("construct.append", nodes))
+            { this->skip(shape_name, nodes, "*", "construction over budget"); return; }
+
+            const shape s = make_shape(shape_name, nodes);
+            std::vector<std::size_t> leaves, inner;
+            split_leaves(s, leaves, inner);
+            std::vector<iterator_type> its;
+            volatile value_type sink{0ull};
+
+            /* construction */
+            tree_type tree;
+            this->report(shape_name, nodes, time_it("construct.append", nodes, nodes,
+                [&]() { build(tree, s, build_method::append, its); }));
+
+            tree_type prepended;
+            std::vector<iterator_type> prepended_its;
+            this->measure(shape_name, nodes, "construct.prepend", nodes, nodes,
+                [&]() { build(prepended, s, build_method::prepend, prepended_its); });
+
+            tree_type inserted;
+            std::vector<iterator_type> inserted_its;
+            this->measure(shape_name, nodes, "construct.insert_after", nodes, nodes,
+                [&]() { build(inserted, s, build_method::insert_after, inserted_its); });
+            inserted_its.clear(); prepended_its.clear();
+
+            this->measure_initializer_list(shape_name, nodes);
+
+            /* iteration */
+            this->measure(shape_name, nodes, "iterate.depth_first", nodes, nodes, [&]()
+            {
+                value_type sum{0ull};
+                for (typename tree_type::template const_iterator<trl::depth_first_pre_order> it = tree.cbegin(); it != tree.cend(); ++it)
+                { sum += *it; }
+                sink = sum;
+            });
+            this->measure(shape_name, nodes, "iterate.post_order", nodes, nodes, [&]()
+            {
+                value_type sum{0ull};
+                for (typename tree_type::template const_iterator<trl::depth_first_post_order> it = tree.template cbegin<trl::depth_first_post_order>();
+                     it != tree.template cend<trl::depth_first_post_order>(); ++it)
+                { sum += *it; }
+                sink = sum;
+            });
+            this->measure(shape_name, nodes, "iterate.breadth_first", nodes, nodes, [&]()
+            {
+                value_type sum{0ull};
+                for (typename tree_type::template const_iterator<trl::breadth_first_in_order> it = tree.template cbegin<trl::breadth_first_in_order>();
+                     it != tree.template cend<trl::breadth_first_in_order>(); ++it)
+                { sum += *it; }
+                sink = sum;
+            });
+
+            /* the same tree in contiguous pre-order arrays, see trl::flat_flex_tree */
+            using flat_type = trl::flat_flex_tree<value_type, std::allocator<value_type>, typename tree_type::policy_type>;
+            flat_type flat;
+            this->measure(shape_name, nodes, "flat.flatten", nodes, nodes,
+                [&]() { flat = flat_type(tree); });
+            this->measure(shape_name, nodes, "flat.iterate.depth_first", nodes, nodes, [&]()
+            {
+                value_type sum{0ull};
+                for (typename flat_type::template const_iterator<trl::depth_first_pre_order> it = flat.cbegin(); it != flat.cend(); ++it)
+                { sum += *it; }
+                sink = sum;
+            });
+            this->measure(shape_name, nodes, "flat.iterate.post_order", nodes, nodes, [&]()
+            {
+                value_type sum{0ull};
+                for (typename flat_type::template const_iterator<trl::depth_first_post_order> it = flat.template cbegin<trl::depth_first_post_order>();
+                     it != flat.template cend<trl::depth_first_post_order>(); ++it)
+                { sum += *it; }
+                sink = sum;
+            });
+            this->measure(shape_name, nodes, "flat.iterate.breadth_first", nodes, nodes, [&]()
+            {
+                value_type sum{0ull};
+                for (typename flat_type::template const_iterator<trl::breadth_first_in_order> it = flat.template cbegin<trl::breadth_first_in_order>();
+                     it != flat.template cend<trl::breadth_first_in_order>(); ++it)
+                { sum += *it; }
+                sink = sum;
+            });
+            flat.clear();
+
+            /* the tree built by insert_after(), with it's nodes moved into pre-order, see flex_tree::compact() */
+            this->measure(shape_name, nodes, "compact", nodes, nodes,
+                [&]() { inserted.compact(); });
+            if (this->history_["compact"].back().second >= 0.0)
+            { this->report_share(shape_name, nodes, "compact.locality", locality(inserted)); }
+            this->measure(shape_name, nodes, "compact.iterate", nodes, nodes, [&]()
+            {
+                value_type sum{0ull};
+                for (typename tree_type::template const_iterator<trl::depth_first_pre_order> it = inserted.cbegin(); it != inserted.cend(); ++it)
+                { sum += *it; }
+                sink = sum;
+            });
+
+            /* concatenation: copies the whole tree, the copy is erased untimed afterwards */
+            iterator_type root = its[0];
+            this->measure_concatenate(shape_name, nodes, "concatenate.append", tree,
+                [&]() { return tree.concatenate_append(tree.end(), root); });
+            this->measure_concatenate(shape_name, nodes, "concatenate.prepend", tree,
+                [&]() { return tree.concatenate_prepend(tree.end(), root); });
+            this->measure_concatenate(shape_name, nodes, "concatenate.after", tree,
+                [&]() { return tree.concatenate_after(root, root); });
+            this->measure_concatenate(shape_name, nodes, "concatenate.before", tree,
+                [&]() { return tree.concatenate_before(root, root); });
+
+            /* splicing: moves leaves below or next to random inner nodes */
+            const std::size_t batch = std::max<std::size_t>(1ull, std::min(nodes / 10, max_batch_ops));
+            std::vector<std::pair<std::size_t, std::size_t>> moves(batch);
+            std::mt19937_64 rng(nodes + 1);
+            for (std::pair<std::size_t, std::size_t>& move : moves)
+            {
+                move.first = inner.empty() ? 0 : inner[std::uniform_int_distribution<std::size_t>(0, inner.size() - 1)(rng)];
+                move.second = leaves[std::uniform_int_distribution<std::size_t>(0, leaves.size() - 1)(rng)];
+            }
+            if (!inner.empty())
+            {
+                this->measure(shape_name, nodes, "splice.append", batch, batch, [&]()
+                { for (const auto& [where, src] : moves) { tree.splice_append(its[where], its[src]); } });
+                this->measure(shape_name, nodes, "splice.prepend", batch, batch, [&]()
+                { for (const auto& [where, src] : moves) { tree.splice_prepend(its[where], its[src]); } });
+                this->measure(shape_name, nodes, "splice.after", batch, batch, [&]()
+                { for (const auto& [where, src] : moves) { tree.splice_after(its[where], its[src]); } });
+                this->measure(shape_name, nodes, "splice.before", batch, batch, [&]()
+                { for (const auto& [where, src] : moves) { tree.splice_before(its[where], its[src]); } });
+            }
+
+            /* erasure */
+            std::shuffle(leaves.begin(), leaves.end(), rng);
+            leaves.resize(std::min(leaves.size(), batch));
+            this->measure(shape_name, nodes, "erase.leaf", leaves.size(), leaves.size(), [&]()
+            { for (std::size_t leaf : leaves) { tree.erase(its[leaf]); } });
+            if (!prepended.empty())
+            {
+                std::size_t erased = prepended.size();
+                this->measure(shape_name, nodes, "erase.subtree", 1, erased, [&]() { prepended.erase(prepended.begin()); });
+            }
+            if (!inserted.empty())
+            {
+                std::size_t erased = inserted.size();
+                this->measure(shape_name, nodes, "clear", 1, erased, [&]() { inserted.clear(); });
+            }
+            its.clear();
+            this->report(shape_name, nodes, time_it("destroy", 1, tree.size(), [&]() { tree_type discard(std::move(tree)); }));
+        }
+
+        template <typename Function>
+        void
+        measure_concatenate(const std::string& shape_name, std::size_t nodes, const std::string& operation,
+                            tree_type& tree, Function&& function)
+        {
+            iterator_type copy;
+            this->measure(shape_name, nodes, operation, 1, nodes, [&]() { copy = function(); });
+            if (copy != iterator_type())
+            { tree.erase(copy); }
+        }
+
+        /**
+         * @brief
+         * braced-initializer-lists have a fixed shape, so a small literal tree
+         * is constructed repeatedly until `nodes` nodes were created.
+         */
+        void
+        measure_initializer_list(const std::string& shape_name, std::size_t nodes)
+        {
+            constexpr std::size_t literal_nodes = 15ull;
+            const std::size_t trees = std::max<std::size_t>(1ull, nodes / literal_nodes);
+            std::vector<tree_type> built;
+            built.reserve(trees);
+            this->measure(shape_name, nodes, "construct.ilist", trees * literal_nodes, trees * literal_nodes, [&]()
+            {
+                for (std::size_t i = 0; i < trees; ++i)
+                {
+                    built.push_back(tree_type
+                    {
+                    {
+                        1,
+                        {
+                            { 2, { 3, 4, 5 } },
+                            { 6, { 7, 8, 9 } },
+                            { 10, { 11, 12, 13, 14 } }
+                        }
+                    },
+                        15
+                    });
+                }
+            });
+        }
+
+        options opts_;
+        std::map<std::string, std::vector<std::pair<std::size_t, double>>> history_;
+    };
+
+    void
+    print_usage(const char* program)
+    {
+        std::printf(
+            "usage: %s [--min-nodes N] [--max-nodes N] [--shape NAME]... [--budget SECONDS] [--allocator NAME] [--links NAME] [--csv]\n"
+            "  --min-nodes N     smallest node-count, grows by a factor of 10 (default 1000)\n"
+            "  --max-nodes N     largest node-count (default 10000000)\n"
+            "  --shape NAME      deep_chain, wide_fanout, balanced or random, repeatable (default all)\n"
+            "  --budget SECONDS  skip operations expected to take longer than this (default 10)\n"
+            "  --allocator NAME  std or pool (trl::pool_allocator) (default std)\n"
+            "  --links NAME      layers (next/prev across cousins), siblings or forward (next only) (default layers)\n"
+            "  --csv             print comma-separated values instead of a table\n", program);
+    }
+
+    struct sibling_links_policy : trl::flex_tree_policy
+    { static constexpr bool layer_links{false}; };
+
+    struct forward_links_policy : sibling_links_policy
+    {
+        static constexpr bool prev_link{false};
+        static constexpr bool last_child_link{false};
+        static constexpr bool child_count{false};
+    };
+
+    template <typename Allocator>
+    void
+    run_with(options opts)
+    {
+        if (opts.links == "siblings")
+        {
+            opts.config += "+siblings";
+            benchmark<trl::flex_tree<value_type, Allocator, sibling_links_policy>>(opts).run();
+        }
+        else if (opts.links == "forward")
+        {
+            opts.config += "+forward";
+            benchmark<trl::flex_tree<value_type, Allocator, forward_links_policy>>(opts).run();
+        }
+        else
+        { benchmark<trl::flex_tree<value_type, Allocator>>(opts).run(); }
+    }
+
+}
 
 int main(int argc, char** argv)
 {
+    options opts;
+    for (int i = 1; i < argc; ++i)
+    {
+        bool has_value = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--min-nodes") && has_value) { opts.min_nodes = std::strtoull(argv[++i], nullptr, 10); }
+        else if (!std::strcmp(argv[i], "--max-nodes") && has_value) { opts.max_nodes = std::strtoull(argv[++i], nullptr, 10); }
+        else if (!std::strcmp(argv[i], "--shape") && has_value) { opts.shapes.emplace_back(argv[++i]); }
+        else if (!std::strcmp(argv[i], "--budget") && has_value) { opts.budget = std::strtod(argv[++i], nullptr); }
+        else if (!std::strcmp(argv[i], "--allocator") && has_value) { opts.allocator = argv[++i]; }
+        else if (!std::strcmp(argv[i], "--links") && has_value) { opts.links = argv[++i]; }
+        else if (!std::strcmp(argv[i], "--csv")) { opts.csv = true; }
+        else { print_usage(argv[0]); return std::strcmp(argv[i], "--help") ? 1 : 0; }
+    }
+    if (opts.shapes.empty())
+    { opts.shapes = { "deep_chain", "wide_fanout", "balanced", "random" }; }
+    if (opts.min_nodes == 0ull)
+    { opts.min_nodes = 1ull; }
+
+    if (opts.links != "layers" && opts.links != "siblings" && opts.links != "forward")
+    { print_usage(argv[0]); return 1; }
 
+    if (opts.allocator == "std")
+    { run_with<std::allocator<value_type>>(opts); }
+    else if (opts.allocator == "pool")
+    {
+        opts.config += "+pool";
+        run_with<trl::pool_allocator<value_type>>(opts);
+    }
+    else { print_usage(argv[0]); return 1; }
     return 0;
-}
\ No newline at end of file
+}
@@ -2,12 +2,1423 @@
 #include <iostream>
 #include <string>
 #include <algorithm>
+#include <span>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <array>
+#include <utility>
+#include <numeric>
 
 #include "../include/treelib/flex_tree.hpp"
+#include "../include/treelib/flat_flex_tree.hpp"
+#include "../include/treelib/n_ary_tree.hpp"
+#include "../include/treelib/flat_n_ary_tree.hpp"
+#include "../include/treelib/ancestor_table.hpp"
+#include "../include/treelib/pool_allocator.hpp"
+
+/* policy for a tree that only links siblings, see trl::flex_tree_policy */
+struct sibling_links : trl::flex_tree_policy 
+{ static constexpr bool layer_links{false}; };
+
+/* policy for a tree whose nodes only store their parent, first child and next sibling */
+struct forward_links : trl::flex_tree_policy
+{
+    static constexpr bool layer_links{false};
+    static constexpr bool prev_link{false};
+    static constexpr bool last_child_link{false};
+    static constexpr bool child_count{false};
+    static constexpr bool depth_count{false};
+};
+
+/* policy for a tree whose nodes know the size of their subtree and can tell their ancestors in O(1) */
+struct sized_subtrees : trl::flex_tree_policy
+{ 
+    static constexpr bool subtree_size{true}; 
+    static constexpr bool ancestor_index{true};
+};
+
+/* policy for a tree whose nodes store their depth */
+struct counted_depths : trl::flex_tree_policy
+{ static constexpr bool depth_count{true}; };
+
+/* policy for a flat_n_ary_tree stored in van-emde-boas order */
+struct veb_layout : trl::flex_tree_policy
+{ static constexpr trl::flat_tree_layout flat_layout{trl::van_emde_boas_layout}; };
+
+/* every failed check is reported, main() returns non-zero if there was any */
+static std::size_t failed_checks = 0;
+#define CHECK(...) \
+    do { if (!(__VA_ARGS__)) { std::cerr << __FILE__ << ':' << __LINE__ << ": check failed: " << #__VA_ARGS__ << '\n'; ++failed_checks; } } while (false)
+
+/* nests the values of a tree in pre-order, e.g. "1(2 3) 4" */
+template <typename Tree>
+std::string shape(const Tree& tree)
+{
+    std::string res;
+    std::size_t last_depth = 1;
+    for (typename Tree::template const_iterator<trl::depth_first_pre_order> i = tree.template cbegin<trl::depth_first_pre_order>(); 
+         i != tree.template cend<trl::depth_first_pre_order>(); ++i)
+    {
+        std::size_t depth = Tree::node_traits::depth(i);
+        if (depth > last_depth) { res += '('; }
+        else if (!res.empty()) { res += std::string(last_depth - depth, ')') + ' '; }
+        res += std::to_string(*i);
+        last_depth = depth;
+    }
+    return res + std::string(last_depth - 1, ')');
+}
+
+template <typename Tree, typename Value>
+typename Tree::template iterator<> find(Tree& tree, const Value& value)
+{ return std::find(tree.begin(), tree.end(), value); }
+
+/* compares every link and counter the policy keeps against the shape of the children-lists below `node` */
+template <typename Policy, typename BasePtr>
+std::size_t well_formed_below(BasePtr node, std::size_t depth, std::vector<std::vector<BasePtr>>& layers, bool& ok)
+{
+    std::vector<BasePtr> children;
+    if (node->first_child_M_ != node)
+    {
+        for (BasePtr child = node->first_child_M_; ; child = child->next_M_)
+        {
+            children.push_back(child);
+            ok = ok && child->parent_M_ == node && children.size() < 1'000'000;
+            if (!ok || child->is_last_child_M_()) { break; }
+        }
+    }
+    if (!ok) { return 0; }
+    if constexpr (Policy::last_child_link)
+    { ok = ok && node->last_child_M_ == (children.empty() ? node : children.back()); }
+    if constexpr (Policy::child_count)
+    { ok = ok && node->child_count_M_ == children.size(); }
+    if constexpr (Policy::depth_count)
+    { ok = ok && (depth == 0 || node->depth_count_M_ == depth); }
+    if constexpr (Policy::prev_link)
+    {
+        for (std::size_t i = 1; i < children.size(); ++i)
+        { ok = ok && children[i]->prev_M_ == children[i - 1]; }
+    }
+    if constexpr (!Policy::layer_links)
+    {
+        if (!children.empty()) { ok = ok && children.back()->next_M_ == children.back(); }
+        if constexpr (Policy::prev_link)
+        { if (!children.empty()) { ok = ok && children.front()->prev_M_ == children.front(); } }
+    }
+    if constexpr (Policy::ancestor_index)
+    {
+        for (std::size_t i = 0; i < children.size(); ++i)
+        {
+            ok = ok && node->enter_label_M_ < children[i]->enter_label_M_ && children[i]->enter_label_M_ < children[i]->exit_label_M_
+                    && children[i]->exit_label_M_ < node->exit_label_M_;
+            if (i) { ok = ok && children[i - 1]->exit_label_M_ < children[i]->enter_label_M_; }
+        }
+    }
+    if (layers.size() <= depth && !children.empty()) { layers.resize(depth + 1); }
+    std::size_t size = 1;
+    for (BasePtr child : children)
+    {
+        layers[depth].push_back(child);
+        size += well_formed_below<Policy>(child, depth + 1, layers, ok);
+    }
+    if constexpr (Policy::subtree_size)
+    { ok = ok && (depth == 0 || node->subtree_size_M_ == size); }
+    return size;
+}
+
+/* checks the whole structure of a tree, including the depth-layer links and size() */
+template <typename Tree>
+bool well_formed(const Tree& tree)
+{
+    using policy_type = typename Tree::policy_type;
+    using base_ptr = decltype(tree.cend().node_ptr_M_());
+    base_ptr header = tree.cend().node_ptr_M_();
+    std::vector<std::vector<base_ptr>> layers;
+    bool ok = true;
+    std::size_t size = well_formed_below<policy_type>(header, 0, layers, ok) - 1;
+    if (!ok) { return false; }
+    if constexpr (policy_type::layer_links)
+    {
+        for (const std::vector<base_ptr>& layer : layers)
+        {
+            for (std::size_t i = 0; i < layer.size(); ++i)
+            {
+                ok = ok && layer[i]->next_M_ == (i + 1 < layer.size() ? layer[i + 1] : layer[i]);
+                if constexpr (policy_type::prev_link)
+                { ok = ok && layer[i]->prev_M_ == (i ? layer[i - 1] : layer[i]); }
+            }
+        }
+        /* the header keeps the ends of the deepest layer */
+        auto header_node = static_cast<const trl::detail__::flex_tree_header_node__<policy_type>*>(header);
+        ok = ok && header_node->height_M_ == layers.size()
+                && header_node->deepest_first_M_ == (layers.empty() ? header : layers.back().front())
+                && header_node->deepest_last_M_ == (layers.empty() ? header : layers.back().back());
+    }
+    return ok && size == tree.size() && tree.empty() == !size;
+}
+
+/* unhooking, copying, erasing, splicing and concatenating subtrees keep every link intact */
+template <typename Policy>
+void check_modifiers()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+    using traits_type = typename tree_type::node_traits;
+
+    /* 5 is a first child with a previous cousin */
+    tree_type tree = { { 1, { 2, 3 } }, { 4, { 5 } } };
+    tree.erase(find(tree, 5));
+    CHECK(well_formed(tree) && shape(tree) == "1(2 3) 4" && !traits_type::has_children(find(tree, 4)));
+
+    /* copies and erasure stop at the last child instead of running into it's cousins */
+    tree = { { 1, { 2, 3 } }, { 4, { 5, 6 } } };
+    tree_type copy(tree.cbegin());
+    CHECK(well_formed(copy) && shape(copy) == "1(2 3)");
+    tree.erase(tree.begin());
+    CHECK(well_formed(tree) && shape(tree) == "4(5 6)");
+    tree.erase(find(tree, 6));
+    CHECK(well_formed(tree) && shape(tree) == "4(5)" && tree.size() == 2);
+
+    /* splices take the layer-links of every descendant along */
+    tree = { { 1, { { 2, { { 3, { 4 } } } } } }, { 5, { 6 } } };
+    tree.splice_append(find(tree, 6), find(tree, 2));
+    CHECK(well_formed(tree) && shape(tree) == "1 5(6(2(3(4))))");
+    tree.splice_before(tree.begin(), find(tree, 3));
+    CHECK(well_formed(tree) && shape(tree) == "3(4) 1 5(6(2))");
+    tree.splice_after(find(tree, 1), find(tree, 6));
+    CHECK(well_formed(tree) && shape(tree) == "3(4) 1 6(2) 5");
+    tree.splice_prepend(find(tree, 5), find(tree, 3));
+    CHECK(well_formed(tree) && shape(tree) == "1 6(2) 5(3(4))");
+
+    /* concatenations weave the copies into the layers and count them */
+    tree_type other = { { 7, { { 8, { 9 } } } } };
+    tree.concatenate_append(find(tree, 2), other.begin());
+    CHECK(well_formed(tree) && shape(tree) == "1 6(2(7(8(9)))) 5(3(4))" && tree.size() == 9);
+    tree.concatenate_prepend(find(tree, 3), other.begin());
+    CHECK(well_formed(tree) && shape(tree) == "1 6(2(7(8(9)))) 5(3(7(8(9)) 4))" && tree.size() == 12);
+    tree.concatenate_before(find(tree, 6), other.begin());
+    tree.concatenate_after(find(tree, 4), other.begin());
+    CHECK(well_formed(tree) && tree.size() == 18 && well_formed(other) && other.size() == 3);
+
+    /* the parent of a node, the root for top-level nodes */
+    CHECK(*traits_type::parent(find(tree, 4)) == 3 && traits_type::is_root(traits_type::parent(tree.begin())));
+}
+
+/* the policy chooses the fields of a node, the missing ones are searched among the siblings instead */
+void check_node_layout()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, forward_links>;
+    using traits_type = tree_type::node_traits;
+    using lean_node = trl::detail__::flex_tree_node__<int, forward_links>;
+    using full_node = trl::detail__::flex_tree_node__<int, trl::flex_tree_policy>;
+
+    CHECK(sizeof(trl::detail__::flex_tree_node_base__<forward_links>) == 3 * sizeof(void*));
+    CHECK(sizeof(lean_node) == 4 * sizeof(void*));
+    CHECK(sizeof(trl::detail__::flex_tree_node_base__<trl::flex_tree_policy>) >= 5 * sizeof(void*) + sizeof(std::size_t));
+    CHECK(sizeof(trl::detail__::flex_tree_node_base__<forward_links>) * 2 <= sizeof(trl::detail__::flex_tree_node_base__<trl::flex_tree_policy>));
+    CHECK(sizeof(lean_node) < sizeof(full_node));
+    CHECK(!std::bidirectional_iterator<tree_type::iterator<trl::depth_first_pre_order>>);
+    CHECK(std::bidirectional_iterator<trl::flex_tree<int>::iterator<trl::depth_first_pre_order>>);
+
+    /* insert_before(), append(), erase() and splices find the previous and last sibling by walking */
+    tree_type tree = { { 1, { 2, 3 } }, { 4, { 5 } } };
+    tree.insert_before(find(tree, 3), 6);
+    tree.append(find(tree, 1), 7);
+    CHECK(well_formed(tree) && shape(tree) == "1(2 6 3 7) 4(5)");
+    tree.erase(find(tree, 3));
+    tree.erase(find(tree, 7));
+    CHECK(well_formed(tree) && shape(tree) == "1(2 6) 4(5)");
+    tree.splice_append(find(tree, 4), find(tree, 6));
+    tree.splice_before(find(tree, 2), find(tree, 5));
+    CHECK(well_formed(tree) && shape(tree) == "1(5 2) 4(6)");
+    CHECK(traits_type::child_count(find(tree, 1)) == 2 && traits_type::depth(find(tree, 6)) == 2);
+    CHECK(std::vector<int>(tree.cbegin<trl::breadth_first_in_order>(), tree.cend<trl::breadth_first_in_order>()) == std::vector<int>({ 1, 4, 6, 2, 5 }));
+}
+
+/* policy for a tree whose reverse-iterators are std::reverse_iterator */
+struct stl_reverse : trl::flex_tree_policy
+{ static constexpr bool stl_reverse_iterator{true}; };
+
+/* the compile-options are part of the type of the default policy, reverse-iterators are chosen by the policy */
+void check_default_policy()
+{
+    using policy = trl::flex_tree_policy;
+    CHECK(std::is_same_v<policy, trl::detail__::flex_tree_policy__<policy::depth_count, policy::no_recursion, policy::exceptions,
+        policy::iterator_exceptions, policy::default_traversal, policy::stl_reverse_iterator>>);
+    CHECK(!std::is_same_v<policy, trl::detail__::flex_tree_policy__<!policy::depth_count, policy::no_recursion, policy::exceptions,
+        policy::iterator_exceptions, policy::default_traversal, policy::stl_reverse_iterator>>);
+
+    using tree_type = trl::flex_tree<int, std::allocator<int>, stl_reverse>;
+    CHECK(std::is_same_v<tree_type::reverse_iterator<>, std::reverse_iterator<tree_type::iterator<>>>);
+    tree_type tree = { { 1, { 2, 3 } }, 4 };
+    CHECK(std::vector<int>(tree.rbegin(), tree.rend()) == std::vector<int>({ 4, 3, 2, 1 }));
+    CHECK(std::vector<int>(tree.crbegin<trl::depth_first_post_order>(), tree.crend<trl::depth_first_post_order>()) == std::vector<int>({ 4, 1, 3, 2 }));
+}
+
+/* depths follow spliced subtrees, deep chains are copied and erased without running past their start */
+template <typename Policy>
+void check_depths()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+    using traits_type = typename tree_type::node_traits;
+
+    tree_type tree = { { 1, { { 2, { 3 } } } }, 4 };
+    tree.splice_append(find(tree, 4), find(tree, 3));
+    CHECK(well_formed(tree) && shape(tree) == "1(2) 4(3)" && traits_type::depth(find(tree, 3)) == 2);
+    tree.splice_append(find(tree, 3), find(tree, 1));
+    CHECK(well_formed(tree) && shape(tree) == "4(3(1(2)))" && traits_type::depth(find(tree, 2)) == 4);
+    tree.splice_before(tree.begin(), find(tree, 1));
+    CHECK(well_formed(tree) && shape(tree) == "1(2) 4(3)" && traits_type::depth(find(tree, 2)) == 2);
+
+    tree_type chain;
+    typename tree_type::template iterator<> where = chain.end();
+    for (int i = 0; i < 1000; ++i)
+    { where = chain.append(where, i); }
+    chain.append(find(chain, 500), -1);
+    tree_type copy(chain.cbegin());
+    CHECK(well_formed(copy) && copy.size() == 1001 && shape(copy) == shape(chain));
+    chain.erase(find(chain, 300));
+    CHECK(well_formed(chain) && chain.size() == 300);
+    chain.concatenate_append(find(chain, 299), copy.begin());
+    CHECK(well_formed(chain) && chain.size() == 1301 && traits_type::depth(find(chain, -1)) == 802);
+}
+
+/* objects of different sizes are pooled and counted separately */
+void check_pool_allocator()
+{
+    trl::pool_allocator<char> small;
+    trl::pool_allocator<std::array<char, 64>> large(small);
+    char* a = small.allocate(1);
+    std::array<char, 64>* b = large.allocate(1);
+    std::array<char, 64>* c = large.allocate(1);
+    CHECK(small.pooled_objects() == 1 && large.pooled_objects() == 2);
+    CHECK(small.chunk_size() == sizeof(void*) && large.chunk_size() == 64);
+    CHECK(reinterpret_cast<std::byte*>(c) - reinterpret_cast<std::byte*>(b) == 64);
+    large.deallocate(c, 1);
+    large.deallocate(b, 1);
+    CHECK(small.pooled_objects() == 1 && large.pooled_objects() == 0);
+    /* a sequential range that doesn't fit the first block moves to a new one, the rest of the first block is reused afterwards */
+    std::vector<char*> sequential, reused;
+    small.reserve_sequential(64);
+    for (std::size_t i = 0; i < 64; ++i) { sequential.push_back(small.allocate(1)); }
+    for (std::size_t i = 1; i < 32; ++i) { reused.push_back(small.allocate(1)); }
+    CHECK(std::ranges::all_of(reused, [&](char* p) { return p > a && p < a + 32 * small.chunk_size(); }));
+    CHECK(std::ranges::none_of(sequential, [&](char* p) { return p >= a && p < a + 32 * small.chunk_size(); }));
+    CHECK(small.pooled_objects() == 96);
+    for (char* p : sequential) { small.deallocate(p, 1); }
+    for (char* p : reused) { small.deallocate(p, 1); }
+    small.deallocate(a, 1);
+}
+
+/* trees only release their size-class of a shared pool at once if nothing else is allocated in it */
+void check_pool_release()
+{
+    using tree_type = trl::flex_tree<int, trl::pool_allocator<int>>;
+    using node_allocator_type = trl::pool_allocator<trl::detail__::flex_tree_node__<int, trl::flex_tree_policy>>;
+    trl::pool_allocator<int> pool;
+    node_allocator_type nodes(pool);
+
+    /* a container of another size in the same pool */
+    std::vector<int, trl::pool_allocator<int>> vector(pool);
+    vector.push_back(42);
+    tree_type tree(pool);
+    tree.append(tree.end(), 7);
+    tree.clear();
+    CHECK(vector[0] == 42 && pool.pooled_objects() == 1 && nodes.pooled_objects() == 0);
+
+    /* a tree whose nodes have another size */
+    trl::flex_tree<std::array<int, 16>, trl::pool_allocator<std::array<int, 16>>> large(pool);
+    large.append(large.end(), { 1 });
+    large.append(large.begin(), { 2 });
+    tree = { 1, 2, 3 };
+    tree.clear();
+    CHECK(large.size() == 2 && (*large.begin())[0] == 1 && (*std::next(large.begin()))[0] == 2 && well_formed(large));
+
+    /* another tree with the same nodes */
+    tree_type other(pool);
+    other = { { 1, { 2 } } };
+    tree = { 3, 4 };
+    CHECK(nodes.pooled_objects() == 4);
+    tree.clear();
+    CHECK(nodes.pooled_objects() == 2 && shape(other) == "1(2)" && well_formed(other));
+    other.clear();
+    CHECK(nodes.pooled_objects() == 0 && vector[0] == 42 && large.size() == 2);
+}
+
+/* moving and swapping re-parent the top-level nodes to the header embedded in the destination */
+template <typename Policy>
+void check_move_and_swap()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+
+    tree_type a = { { 1, { 2 } }, 3 };
+    tree_type b(std::move(a));
+    CHECK(well_formed(b) && shape(b) == "1(2) 3" && std::next(find(b, 3)) == b.end());
+    CHECK(well_formed(a) && a.empty() && a.begin() == a.end());
+    a.append(a.end(), 4);
+    CHECK(well_formed(a) && shape(a) == "4");
+
+    swap(a, b);
+    CHECK(well_formed(a) && shape(a) == "1(2) 3" && well_formed(b) && shape(b) == "4");
+    tree_type empty;
+    swap(b, empty);
+    CHECK(well_formed(b) && b.empty() && well_formed(empty) && shape(empty) == "4");
+
+    b = std::move(a);
+    CHECK(well_formed(b) && shape(b) == "1(2) 3" && well_formed(a) && a.empty());
+    b.append(find(b, 3), 5);
+    CHECK(well_formed(b) && shape(b) == "1(2) 3(5)");
+}
+
+/* a value that cannot be constructed from negative numbers and counts it's instances */
+struct throwing_value
+{
+    static inline int alive = 0;
+    int value;
+
+    throwing_value(int v) : value(v) { if (v < 0) { throw std::invalid_argument("negative value"); } ++alive; }
+    throwing_value(const throwing_value& other) : value(other.value) { ++alive; }
+    ~throwing_value() { --alive; }
+};
+
+/* initializer-lists build every node through the tree's allocator and release them again if a value throws */
+template <typename Policy>
+void check_initializer_list()
+{
+    using allocator_type = trl::pool_allocator<throwing_value>;
+    using tree_type = trl::flex_tree<throwing_value, allocator_type, Policy>;
+    trl::pool_allocator<trl::detail__::flex_tree_node__<throwing_value, Policy>> nodes;
+    allocator_type pool(nodes);
+
+    tree_type tree({ { 1, { 2, 3 } }, { 4, { 5 } } }, pool);
+    CHECK(well_formed(tree) && tree.size() == 5 && nodes.pooled_objects() == 5 && throwing_value::alive == 5);
+    CHECK(tree.begin()->value == 1 && std::prev(tree.end())->value == 5);
+
+    bool thrown = false;
+    try { tree_type broken({ { 1, { { 2, { 3, -1 } } } }, 4 }, pool); }
+    catch (const std::invalid_argument&) { thrown = true; }
+    CHECK(thrown && nodes.pooled_objects() == 5 && throwing_value::alive == 5);
+
+    thrown = false;
+    try { tree = { { 6, { 7 } }, -1 }; }
+    catch (const std::invalid_argument&) { thrown = true; }
+    CHECK(thrown && tree.empty() && well_formed(tree) && nodes.pooled_objects() == 0 && throwing_value::alive == 0);
+
+    using n_ary_type = trl::n_ary_tree<throwing_value, 2, allocator_type, Policy>;
+    trl::pool_allocator<trl::detail__::n_ary_tree_node__<throwing_value, 2>> n_ary_nodes(pool);
+    thrown = false;
+    try { n_ary_type broken({ { 1, { 2, -1 } } }, pool); }
+    catch (const std::invalid_argument&) { thrown = true; }
+    CHECK(thrown && n_ary_nodes.pooled_objects() == 0 && throwing_value::alive == 0);
+}
+
+/* a value that counts how often it was copied, moved-from values are -1 */
+struct copy_counter
+{
+    static inline int copies = 0;
+    int value;
+
+    copy_counter(int v) : value(v) { }
+    copy_counter(const copy_counter& other) : value(other.value) { ++copies; }
+    copy_counter(copy_counter&& other) noexcept : value(other.value) { other.value = -1; }
+};
+
+/* rvalues are moved into the new nodes and emplace_* constructs them in-place */
+void check_rvalue_insertion()
+{
+    using tree_type = trl::flex_tree<copy_counter>;
+    tree_type tree;
+    copy_counter a(1), b(2), c(3), d(4);
+    copy_counter::copies = 0;
+    tree_type::iterator<> first = tree.append(tree.end(), std::move(a));
+    tree.prepend(first, std::move(b));
+    tree.insert_after(first, std::move(c));
+    tree.insert_before(first, std::move(d));
+    tree.emplace_append(first, 5);
+    tree.emplace_prepend(first, 6);
+    tree.emplace_after(first, 7);
+    tree.emplace_before(first, 8);
+    CHECK(copy_counter::copies == 0 && a.value == -1 && b.value == -1 && c.value == -1 && d.value == -1);
+    CHECK(well_formed(tree) && tree.size() == 8 && first->value == 1 && trl::flex_tree<copy_counter>::node_traits::child_count(first) == 3);
+}
+
+/* a tree of `count` nodes, every node appended below a random node before it */
+template <typename Tree>
+Tree random_tree(std::size_t count, unsigned seed)
+{
+    Tree tree;
+    std::vector<typename Tree::template iterator<>> nodes{ tree.end() };
+    std::mt19937 rng(seed);
+    for (std::size_t i = 0; i < count; ++i)
+    { nodes.push_back(tree.append(nodes[std::uniform_int_distribution<std::size_t>(0, nodes.size() - 1)(rng)], static_cast<int>(i))); }
+    return tree;
+}
+
+/* the layers of a tree from the top, walked alternately left-to-right and right-to-left */
+template <trl::traversal Traversal, typename Tree>
+std::vector<int> expected_breadth_first(const Tree& tree)
+{
+    std::vector<std::vector<int>> layers;
+    for (typename Tree::template const_iterator<trl::depth_first_pre_order> i = tree.template cbegin<trl::depth_first_pre_order>(); 
+         i != tree.template cend<trl::depth_first_pre_order>(); ++i)
+    {
+        std::size_t depth = Tree::node_traits::depth(i);
+        if (layers.size() < depth) { layers.resize(depth); }
+        layers[depth - 1].push_back(*i);
+    }
+    std::vector<int> res;
+    bool reversed = Traversal == trl::breadth_first_reverse_order;
+    for (const std::vector<int>& layer : layers)
+    {
+        if (reversed) { res.insert(res.end(), layer.rbegin(), layer.rend()); }
+        else { res.insert(res.end(), layer.begin(), layer.end()); }
+        reversed = !reversed;
+    }
+    return res;
+}
+
+template <trl::traversal Traversal, typename Tree>
+std::vector<int> values(const Tree& tree)
+{ return std::vector<int>(tree.template cbegin<Traversal>(), tree.template cend<Traversal>()); }
+
+/* the values walking backwards from end(), in the order of Traversal again */
+template <trl::traversal Traversal, typename Tree>
+std::vector<int> values_from_end(const Tree& tree)
+{
+    std::vector<int> res;
+    for (typename Tree::template const_iterator<Traversal> i = tree.template cend<Traversal>(); i != tree.template cbegin<Traversal>(); )
+    { res.push_back(*--i); }
+    std::reverse(res.begin(), res.end());
+    return res;
+}
+
+template <typename Tree, trl::traversal Traversal>
+concept appends_through = requires (Tree& tree, typename Tree::template iterator<Traversal> where) { tree.append(where, 0); };
+
+/* breadth-first iteration visits every layer, alternating it's direction, also backwards from end() */
+template <typename Policy>
+void check_breadth_first()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+    using forward_type = typename tree_type::template iterator<trl::breadth_first_in_order>;
+
+    tree_type empty;
+    CHECK(empty.template begin<trl::breadth_first_in_order>() == empty.template end<trl::breadth_first_in_order>());
+    for (unsigned seed = 0; seed < 8; ++seed)
+    {
+        tree_type tree = random_tree<tree_type>(seed * 40 + 1, seed);
+        CHECK(values<trl::breadth_first_in_order>(tree) == expected_breadth_first<trl::breadth_first_in_order>(tree));
+        CHECK(values<trl::breadth_first_reverse_order>(tree) == expected_breadth_first<trl::breadth_first_reverse_order>(tree));
+        if constexpr (std::bidirectional_iterator<forward_type>)
+        {
+            CHECK(values_from_end<trl::breadth_first_in_order>(tree) == expected_breadth_first<trl::breadth_first_in_order>(tree));
+            CHECK(values_from_end<trl::breadth_first_reverse_order>(tree) == expected_breadth_first<trl::breadth_first_reverse_order>(tree));
+            CHECK(*tree.template rbegin<trl::breadth_first_in_order>() == expected_breadth_first<trl::breadth_first_in_order>(tree).back());
+        }
+        /* erase() steps on from the erased node, without restarting the iteration */
+        std::vector<int> visited, expected = expected_breadth_first<trl::breadth_first_in_order>(tree);
+        for (forward_type i = tree.template begin<trl::breadth_first_in_order>(); i != tree.template end<trl::breadth_first_in_order>(); )
+        {
+            visited.push_back(*i);
+            if (*i % 3 == 2) { i = tree.erase(i); } else { ++i; }
+        }
+        CHECK(well_formed(tree) && values<trl::breadth_first_in_order>(tree) == expected_breadth_first<trl::breadth_first_in_order>(tree));
+        /* visits the nodes in the order of the unmodified tree, only skipping the erased subtrees */
+        std::size_t matched = 0;
+        for (int value : expected) { if (matched < visited.size() && visited[matched] == value) { ++matched; } }
+        CHECK(matched == visited.size() && visited.size() >= tree.size());
+    }
+    /* without layer-links, a breadth-first iterator to a new node would rebuild the layers above it */
+    CHECK(appends_through<tree_type, trl::breadth_first_in_order> == Policy::layer_links);
+    CHECK(appends_through<tree_type, trl::breadth_first_reverse_order> == Policy::layer_links);
+    CHECK(appends_through<tree_type, trl::depth_first_pre_order> && appends_through<tree_type, trl::depth_first_post_order>);
+}
+
+template <typename Tree>
+concept modifiable_tree = requires (Tree& tree) { tree.append(tree.end(), 0); tree.erase(tree.begin()); tree.clear(); };
+
+/* a frozen snapshot only hands out const-access, and thaws back into the same tree */
+void check_freeze()
+{
+    using tree_type = trl::flex_tree<int>;
+    using frozen_type = trl::frozen_flex_tree<int>;
+
+    tree_type tree = random_tree<tree_type>(50, 7);
+    frozen_type snapshot = trl::freeze(tree);
+    CHECK(std::is_same_v<decltype(snapshot.begin()), frozen_type::const_iterator<>>);
+    CHECK(std::is_const_v<std::remove_reference_t<decltype(*snapshot.begin())>>);
+    CHECK(!modifiable_tree<frozen_type> && modifiable_tree<trl::flat_flex_tree<int>> && modifiable_tree<tree_type>);
+    CHECK(snapshot.size() == tree.size() && std::equal(snapshot.begin(), snapshot.end(), tree.cbegin(), tree.cend()));
+    CHECK(std::equal(snapshot.begin<trl::breadth_first_in_order>(), snapshot.end<trl::breadth_first_in_order>(),
+                     tree.cbegin<trl::breadth_first_in_order>(), tree.cend<trl::breadth_first_in_order>()));
+    CHECK(frozen_type::node_traits::depth(std::prev(snapshot.end())) == tree_type::node_traits::depth(std::prev(tree.cend())));
+
+    tree_type thawed = trl::thaw(snapshot);
+    CHECK(well_formed(thawed) && shape(thawed) == shape(tree));
+    thawed.append(thawed.end(), -1);
+    CHECK(snapshot.size() == tree.size() && thawed.size() == tree.size() + 1);
+}
+
+/* value whose copy-constructor throws once `copies_left` copies were made */
+struct limited_copies
+{
+    static inline int copies_left = 1'000'000;
+    int value;
+
+    limited_copies(int v) : value(v) { }
+    limited_copies(const limited_copies& other) : value(other.value) { if (!copies_left--) { throw std::runtime_error("out of copies"); } }
+    bool operator==(const limited_copies&) const = default;
+};
+
+/* the nodes of a tree scattered over it's pool by erasures and splices */
+template <typename Tree>
+Tree scattered_tree(const typename Tree::allocator_type& allocator, unsigned seed)
+{
+    Tree tree(allocator);
+    std::vector<typename Tree::template iterator<>> nodes{ tree.end() };
+    std::mt19937 rng(seed);
+    for (int i = 0; i < 300; ++i)
+    {
+        nodes.push_back(tree.append(nodes[rng() % nodes.size()], i));
+        if (i % 3 == 2 && nodes.size() > 2)
+        {
+            /* erasing leaves puts their chunks on the free-list, the next appends take them back out of order */
+            typename Tree::template iterator<> leaf = nodes[1 + rng() % (nodes.size() - 1)];
+            while (Tree::node_traits::has_children(leaf)) { leaf = Tree::node_traits::first_child(leaf); }
+            nodes.erase(std::find(nodes.begin(), nodes.end(), leaf));
+            tree.erase(leaf);
+        }
+    }
+    return tree;
+}
+
+/* the addresses of the nodes in `Traversal`-order, as distances to the first one */
+template <trl::traversal Traversal, typename Tree>
+std::vector<std::ptrdiff_t> node_offsets(const Tree& tree)
+{
+    std::vector<std::ptrdiff_t> res;
+    for (typename Tree::template const_iterator<Traversal> i = tree.template cbegin<Traversal>(); i != tree.template cend<Traversal>(); ++i)
+    {
+        res.push_back(reinterpret_cast<const char*>(i.node_ptr_M_()) 
+                    - reinterpret_cast<const char*>(tree.template cbegin<Traversal>().node_ptr_M_()));
+    }
+    return res;
+}
+
+/* compact() keeps the structure, and with a pool lays out the nodes side by side in traversal-order */
+template <typename Policy>
+void check_compact()
+{
+    using tree_type = trl::flex_tree<int, trl::pool_allocator<int>, Policy>;
+    using node_allocator_type = trl::pool_allocator<trl::detail__::flex_tree_node__<int, Policy>>;
+    constexpr std::ptrdiff_t chunk = static_cast<std::ptrdiff_t>(node_allocator_type::chunk_size());
+    trl::pool_allocator<int> pool;
+
+    for (unsigned seed = 0; seed < 4; ++seed)
+    {
+        tree_type tree = scattered_tree<tree_type>(pool, seed);
+        std::string before = shape(tree);
+        std::vector<int> breadth_first = values<trl::breadth_first_in_order>(tree);
+        std::vector<std::ptrdiff_t> sequential(tree.size());
+        for (std::size_t i = 0; i < sequential.size(); ++i) { sequential[i] = static_cast<std::ptrdiff_t>(i) * chunk; }
+        CHECK(node_offsets<trl::depth_first_pre_order>(tree) != sequential);
+
+        tree.compact();
+        CHECK(well_formed(tree) && shape(tree) == before && values<trl::breadth_first_in_order>(tree) == breadth_first);
+        CHECK(node_offsets<trl::depth_first_pre_order>(tree) == sequential);
+        CHECK(node_allocator_type(pool).pooled_objects() == tree.size());
+
+        tree.template compact<trl::breadth_first_in_order>();
+        CHECK(well_formed(tree) && shape(tree) == before);
+        CHECK(node_offsets<trl::breadth_first_in_order>(tree) == sequential);
+        /* the reservation ends with compact(), later nodes come from the free-list again */
+        tree.append(tree.end(), -1);
+        CHECK(well_formed(tree) && node_allocator_type(pool).pooled_objects() == tree.size());
+    }
+
+    /* a throwing copy leaves the tree and the pool as they were */
+    using copy_tree_type = trl::flex_tree<limited_copies, trl::pool_allocator<limited_copies>, Policy>;
+    using copy_node_allocator_type = trl::pool_allocator<trl::detail__::flex_tree_node__<limited_copies, Policy>>;
+    trl::pool_allocator<limited_copies> copy_pool;
+    copy_tree_type tree(copy_pool);
+    tree = { { 1, { 2, 3 } }, { 4, { { 5, { 6 } } } } };
+    limited_copies::copies_left = 3;
+    bool thrown = false;
+    try { tree.compact(); } catch (const std::runtime_error&) { thrown = true; }
+    limited_copies::copies_left = 1'000'000;
+    CHECK(thrown && well_formed(tree) && copy_node_allocator_type(copy_pool).pooled_objects() == 6);
+    CHECK(std::vector<limited_copies>(tree.begin(), tree.end()) == std::vector<limited_copies>({ 1, 2, 3, 4, 5, 6 }));
+    tree.compact();
+    CHECK(well_formed(tree) && copy_node_allocator_type(copy_pool).pooled_objects() == 6);
+}
+
+/* nth() and index_of() agree with iterating in pre- and post-order, also after erasures, splices and concatenations */
+template <typename Policy>
+void check_nth()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+    using iterator_type = typename tree_type::template iterator<>;
+    auto agrees = []<trl::traversal Traversal>(tree_type& tree, std::integral_constant<trl::traversal, Traversal>)
+    {
+        const tree_type& c_tree = tree;
+        bool ok = tree.template nth<Traversal>(tree.size()) == tree.template end<Traversal>() 
+               && tree.index_of(tree.template end<Traversal>()) == tree.size();
+        std::size_t index = 0;
+        for (typename tree_type::template iterator<Traversal> i = tree.template begin<Traversal>(); i != tree.template end<Traversal>(); ++i, ++index)
+        { ok = ok && tree.template nth<Traversal>(index) == i && c_tree.template nth<Traversal>(index) == i && tree.index_of(i) == index; }
+        return ok && index == tree.size();
+    };
+    using pre_order = std::integral_constant<trl::traversal, trl::depth_first_pre_order>;
+    using post_order = std::integral_constant<trl::traversal, trl::depth_first_post_order>;
+
+    tree_type empty;
+    CHECK(agrees(empty, pre_order{}) && agrees(empty, post_order{}));
+    for (unsigned seed = 0; seed < 6; ++seed)
+    {
+        tree_type tree = random_tree<tree_type>(60, seed);
+        std::mt19937 rng(seed);
+        CHECK(agrees(tree, pre_order{}) && agrees(tree, post_order{}));
+        for (int step = 0; step < 30 && tree.size() > 1; ++step)
+        {
+            std::vector<iterator_type> nodes;
+            for (iterator_type i = tree.begin(); i != tree.end(); ++i) { nodes.push_back(i); }
+            iterator_type a = nodes[rng() % nodes.size()], b = nodes[rng() % nodes.size()];
+            if (step % 3 == 0) { tree.erase(a); }
+            else if (step % 3 == 1) { if (a != b && !tree_type::node_traits::is_ancestor(b, a)) { tree.splice_append(a, b); } }
+            else if (tree.size() < 200) { tree.concatenate_after(a, b); }
+            CHECK(well_formed(tree) && agrees(tree, pre_order{}) && agrees(tree, post_order{}));
+        }
+    }
+    if constexpr (Policy::exceptions)
+    {
+        tree_type tree = { 1, 2 };
+        bool thrown = false;
+        try { tree.nth(3); } catch (const std::out_of_range&) { thrown = true; }
+        CHECK(thrown);
+    }
+}
+
+/* sample() picks every node about equally often, sample_in_subtree() never leaves the subtree */
+template <typename Policy>
+void check_sample()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+    using traits_type = typename tree_type::node_traits;
+    using iterator_type = typename tree_type::template iterator<>;
+    std::mt19937 rng(42);
+
+    tree_type empty;
+    CHECK(empty.sample(rng) == empty.end() && empty.sample_in_subtree(empty.end(), rng) == empty.end());
+    CHECK(std::as_const(empty).sample(rng) == empty.cend());
+
+    /* 200k draws from 50 nodes: 4000 per node, the standard deviation is about 63 */
+    tree_type tree = random_tree<tree_type>(50, 7);
+    std::vector<std::size_t> drawn(50, 0);
+    for (std::size_t i = 0; i < 200'000; ++i) { ++drawn[*tree.sample(rng)]; }
+    CHECK(std::ranges::all_of(drawn, [](std::size_t count) { return count > 3600 && count < 4400; }));
+
+    auto within = [](iterator_type node, iterator_type where)
+    {
+        for (; !traits_type::is_root(node); node = traits_type::parent(node)) { if (node == where) { return true; } }
+        return false;
+    };
+    for (unsigned seed = 0; seed < 4; ++seed)
+    {
+        tree = random_tree<tree_type>(60, seed);
+        for (int step = 0; step < 20 && tree.size() > 1; ++step)
+        {
+            std::vector<iterator_type> nodes;
+            for (iterator_type i = tree.begin(); i != tree.end(); ++i) { nodes.push_back(i); }
+            iterator_type a = nodes[rng() % nodes.size()], b = nodes[rng() % nodes.size()];
+            if (step % 2) { tree.erase(a); }
+            else if (a != b && !traits_type::is_ancestor(b, a)) { tree.splice_append(a, b); }
+            nodes.clear();
+            for (iterator_type i = tree.begin(); i != tree.end(); ++i) { nodes.push_back(i); }
+            for (iterator_type where : nodes)
+            {
+                bool ok = true;
+                for (int draw = 0; draw < 20; ++draw) { ok = ok && within(tree.sample_in_subtree(where, rng), where); }
+                CHECK(ok);
+            }
+            CHECK((tree.sample_in_subtree(tree.end(), rng) == tree.end()) == tree.empty());
+        }
+    }
+}
+
+/* lowest common ancestor by walking up from both nodes */
+template <typename Tree, typename Iterator>
+Iterator naive_lca(Iterator a, Iterator b)
+{
+    using traits_type = typename Tree::node_traits;
+    std::vector<Iterator> path;
+    for (Iterator i = a; ; i = traits_type::parent(i)) { path.push_back(i); if (traits_type::is_root(i)) { break; } }
+    for (Iterator i = b; ; i = traits_type::parent(i)) { if (std::find(path.begin(), path.end(), i) != path.end()) { return i; } }
+}
+
+/* an ancestor_table answers like walking up, and refuses to answer once the tree was modified */
+template <typename Policy>
+void check_ancestor_table()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+    using table_type = trl::ancestor_table<int, std::allocator<int>, Policy>;
+    using iterator_type = typename tree_type::template iterator<>;
+
+    tree_type tree = { { 1, { { 2, { 3, 4 } }, { 5, { 6, 7 } } } } };
+    table_type table(tree);
+    CHECK(table.is_current(tree) && *table.lca(find(tree, 3), find(tree, 4)) == 2 && *table.lca(find(tree, 3), find(tree, 7)) == 1);
+    CHECK(*table.ancestor(find(tree, 3), 2) == 1 && table.depth(find(tree, 7)) == 3 && table.ancestor_at_depth(find(tree, 7), 0) == tree.end());
+
+    /* 99 is not in the table, and 2 already has other children: the old structure would answer wrongly */
+    tree.erase(find(tree, 6));
+    tree.append(find(tree, 2), 99);
+    CHECK(!table.is_current(tree));
+    if constexpr (Policy::exceptions)
+    {
+        bool thrown = false;
+        try { table.lca(find(tree, 99), find(tree, 3)); } catch (const std::logic_error&) { thrown = true; }
+        CHECK(thrown);
+        thrown = false;
+        try { table.depth(find(tree, 3)); } catch (const std::logic_error&) { thrown = true; }
+        CHECK(thrown);
+    }
+    table.rebuild(tree);
+    CHECK(table.is_current(tree) && *table.lca(find(tree, 99), find(tree, 3)) == 2 && table.size() == 7);
+
+    /* splices, compaction, moves and swaps leave the table behind as well */
+    auto stale_after = [&](auto modify) { table.rebuild(tree); modify(); return !table.is_current(tree); };
+    CHECK(stale_after([&]() { tree.splice_append(find(tree, 5), find(tree, 3)); }));
+    CHECK(stale_after([&]() { tree.compact(); }));
+    CHECK(stale_after([&]() { tree_type other(std::move(tree)); tree = std::move(other); }));
+    CHECK(stale_after([&]() { tree_type other = { 8 }; swap(tree, other); swap(tree, other); }));
+    CHECK(stale_after([&]() { tree = { 1, 2 }; }));
+    table.rebuild(tree);
+    tree_type copy(tree);
+    CHECK(table.is_current(tree) && !table.is_current(copy));
+
+    /* every pair of nodes of random trees against walking up */
+    for (unsigned seed = 0; seed < 4; ++seed)
+    {
+        tree = random_tree<tree_type>(40, seed);
+        table.rebuild(tree);
+        std::vector<iterator_type> nodes;
+        for (iterator_type i = tree.begin(); i != tree.end(); ++i) { nodes.push_back(i); }
+        for (iterator_type a : nodes)
+        {
+            for (iterator_type b : nodes)
+            { CHECK(table.lca(a, b) == naive_lca<tree_type>(a, b)); }
+            iterator_type top = a;
+            while (!tree_type::node_traits::is_root(tree_type::node_traits::parent(top))) { top = tree_type::node_traits::parent(top); }
+            CHECK(table.depth(a) == tree_type::node_traits::depth(a) && table.ancestor(a, table.depth(a) - 1) == top);
+        }
+    }
+}
+
+/* node_traits::is_ancestor() answers like walking up, also after splices and after labels had to be spread again */
+template <typename Policy>
+void check_is_ancestor()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+    using traits_type = typename tree_type::node_traits;
+    using iterator_type = typename tree_type::template iterator<>;
+    auto walk_up = [](iterator_type ancestor, iterator_type node)
+    {
+        while (!traits_type::is_root(node)) { node = traits_type::parent(node); if (node == ancestor) { return true; } }
+        return false;
+    };
+    auto nodes_of = [](tree_type& tree)
+    {
+        std::vector<iterator_type> nodes{ tree.end() };
+        for (iterator_type i = tree.begin(); i != tree.end(); ++i) { nodes.push_back(i); }
+        return nodes;
+    };
+    auto answers_like_walk = [&](tree_type& tree)
+    {
+        bool ok = true;
+        for (iterator_type a : nodes_of(tree)) { for (iterator_type b : nodes_of(tree)) { ok = ok && traits_type::is_ancestor(a, b) == walk_up(a, b); } }
+        return ok;
+    };
+
+    for (unsigned seed = 0; seed < 4; ++seed)
+    {
+        tree_type tree = random_tree<tree_type>(50, seed);
+        std::mt19937 rng(seed);
+        for (int step = 0; step < 20; ++step)
+        {
+            std::vector<iterator_type> nodes = nodes_of(tree);
+            iterator_type a = nodes[1 + rng() % (nodes.size() - 1)], b = nodes[1 + rng() % (nodes.size() - 1)];
+            if (a != b && !walk_up(b, a)) { tree.splice_append(a, b); }
+        }
+        CHECK(well_formed(tree) && answers_like_walk(tree));
+    }
+
+    /* every insertion between the same two nodes halves the room between their labels, until a surrounding range is spread again */
+    tree_type dense = { { 1, { 2 } }, 3 };
+    auto labels_of = [](auto& tree)
+    {
+        std::vector<std::uint64_t> res;
+        for (int value : { 1, 2, 3 }) { res.push_back(find(tree, value).node_ptr_M_()->enter_label_M_); res.push_back(find(tree, value).node_ptr_M_()->exit_label_M_); }
+        return res;
+    };
+    std::vector<std::uint64_t> labels;
+    if constexpr (Policy::ancestor_index) { labels = labels_of(dense); }
+    for (int i = 0; i < 200; ++i) { dense.append(dense.insert_after(find(dense, 2), 100 + i), 1000 + i); }
+    CHECK(well_formed(dense) && dense.size() == 403 && answers_like_walk(dense));
+    if constexpr (Policy::ancestor_index) { CHECK(labels != labels_of(dense)); }
+
+    /* labels of different trees may nest, is_ancestor() must not take that for an answer */
+    tree_type a = { { 1, { 2 } } }, b = { { 1, { 2 } } };
+    if constexpr (!Policy::ancestor_index)
+    { CHECK(!traits_type::is_ancestor(a.begin(), find(b, 2)) && !traits_type::is_ancestor(a.end(), b.begin())); }
+    else if constexpr (Policy::exceptions)
+    {
+        bool thrown = false;
+        try { traits_type::is_ancestor(a.begin(), find(b, 2)); } catch (const std::invalid_argument&) { thrown = true; }
+        CHECK(thrown && !traits_type::is_ancestor(find(a, 2), b.begin()));
+    }
+}
+
+/* walking backwards from end() starts at the deepest layer kept by the header, which follows every modification */
+template <typename Policy>
+void check_deepest_layer()
+{
+    using tree_type = trl::flex_tree<int, std::allocator<int>, Policy>;
+    auto last = [](const tree_type& tree, auto traversal)
+    { return *std::prev(tree.template cend<decltype(traversal)::value>()); };
+    using in_order = std::integral_constant<trl::traversal, trl::breadth_first_in_order>;
+    using reverse_order = std::integral_constant<trl::traversal, trl::breadth_first_reverse_order>;
+
+    /* the deepest layer shrinks, grows, and disappears with erasures and insertions */
+    tree_type tree = { { 1, { { 2, { 3, 4 } }, { 5, { 6, 7 } } } } };
+    CHECK(well_formed(tree) && last(tree, in_order{}) == 7 && last(tree, reverse_order{}) == 3);
+    tree.erase(find(tree, 6));
+    tree.append(find(tree, 2), 99);
+    CHECK(well_formed(tree) && last(tree, in_order{}) == 7 && last(tree, reverse_order{}) == 3);
+    tree.erase(find(tree, 2));
+    CHECK(well_formed(tree) && shape(tree) == "1(5(7))" && last(tree, in_order{}) == 7);
+    tree.erase(find(tree, 7));
+    CHECK(well_formed(tree) && last(tree, in_order{}) == 5 && last(tree, reverse_order{}) == 5);
+    tree.append(find(tree, 5), 8);
+    tree.append(find(tree, 8), 9);
+    CHECK(well_formed(tree) && last(tree, in_order{}) == 9);
+
+    /* splices lift the deepest layer out of the tree or sink a subtree below it */
+    tree.splice_after(find(tree, 5), find(tree, 8));
+    CHECK(well_formed(tree) && shape(tree) == "1(5 8(9))" && last(tree, in_order{}) == 9);
+    tree.splice_after(tree.begin(), find(tree, 8));
+    CHECK(well_formed(tree) && shape(tree) == "1(5) 8(9)" && last(tree, in_order{}) == 5 && last(tree, reverse_order{}) == 9);
+    tree.splice_before(tree.begin(), find(tree, 9));
+    CHECK(well_formed(tree) && shape(tree) == "9 1(5) 8" && last(tree, in_order{}) == 5);
+    tree.splice_append(find(tree, 5), find(tree, 8));
+    CHECK(well_formed(tree) && last(tree, in_order{}) == 8);
+
+    /* concatenations and copies take the deepest layer of their source along */
+    tree_type other = { { 10, { { 11, { 12 } } } } };
+    tree.concatenate_prepend(find(tree, 8), other.begin());
+    CHECK(well_formed(tree) && shape(tree) == "9 1(5(8(10(11(12)))))" && last(tree, in_order{}) == 12);
+    tree_type copy(tree);
+    tree.clear();
+    CHECK(well_formed(tree) && well_formed(copy) && last(copy, in_order{}) == 12);
+    CHECK(tree.template cbegin<trl::breadth_first_in_order>() == tree.template cend<trl::breadth_first_in_order>());
+    tree_type moved(std::move(copy));
+    CHECK(well_formed(moved) && well_formed(copy) && last(moved, reverse_order{}) == 12);
+
+    /* random modifications against a walk of the layers */
+    for (unsigned seed = 0; seed < 8; ++seed)
+    {
+        tree = random_tree<tree_type>(60, seed);
+        std::mt19937 rng(seed);
+        for (int step = 0; step < 40 && tree.size() > 1; ++step)
+        {
+            std::vector<typename tree_type::template iterator<>> nodes;
+            for (typename tree_type::template iterator<> i = tree.begin(); i != tree.end(); ++i) { nodes.push_back(i); }
+            typename tree_type::template iterator<> a = nodes[rng() % nodes.size()], b = nodes[rng() % nodes.size()];
+            if (step % 2) { tree.erase(a); }
+            else if (!tree_type::node_traits::is_ancestor(b, a) && a != b) { tree.splice_append(a, b); }
+            CHECK(well_formed(tree));
+            CHECK(values_from_end<trl::breadth_first_in_order>(tree) == expected_breadth_first<trl::breadth_first_in_order>(tree));
+            CHECK(values_from_end<trl::breadth_first_reverse_order>(tree) == expected_breadth_first<trl::breadth_first_reverse_order>(tree));
+        }
+    }
+}
+
+/* the slots of an n_ary_tree of distinct values, kept next to it: children[v][k] is the value in slot k of v, -1 if empty */
+template <std::size_t Size>
+struct n_ary_model
+{
+    std::array<int, Size> top;
+    std::vector<std::array<int, Size>> children;
+    std::vector<int> parent; /* -1 for top-level nodes, -2 for values not in the tree */
+    std::size_t size = 0;
+
+    n_ary_model() { top.fill(-1); }
+
+    std::array<int, Size>& slots_of(int value) { return value < 0 ? top : children[value]; }
+
+    void insert(int where, std::size_t slot, int value)
+    {
+        if (children.size() <= static_cast<std::size_t>(value)) { children.resize(value + 1); parent.resize(value + 1, -2); }
+        children[value].fill(-1);
+        slots_of(where)[slot] = value;
+        parent[value] = where;
+        ++size;
+    }
+
+    void erase(int value)
+    {
+        std::replace(slots_of(parent[value]).begin(), slots_of(parent[value]).end(), value, -1);
+        std::vector<int> stack{ value };
+        while (!stack.empty())
+        {
+            int node = stack.back();
+            stack.pop_back();
+            parent[node] = -2;
+            --size;
+            for (int child : children[node]) { if (child >= 0) { stack.push_back(child); } }
+        }
+    }
+
+    bool below(int node, int ancestor) const
+    {
+        for (; node >= 0; node = parent[node]) { if (node == ancestor) { return true; } }
+        return false;
+    }
+
+    void depth_first(int node, std::vector<int>& pre, std::vector<int>& post) const
+    {
+        pre.push_back(node);
+        for (int child : children[node]) { if (child >= 0) { depth_first(child, pre, post); } }
+        post.push_back(node);
+    }
+
+    template <trl::traversal Traversal>
+    std::vector<int> order() const
+    {
+        std::vector<int> pre, post, res;
+        for (int node : top) { if (node >= 0) { depth_first(node, pre, post); } }
+        if constexpr (Traversal == trl::depth_first_pre_order) { return pre; }
+        if constexpr (Traversal == trl::depth_first_post_order) { return post; }
+        std::vector<int> layer;
+        for (int node : top) { if (node >= 0) { layer.push_back(node); } }
+        bool reversed = Traversal == trl::breadth_first_reverse_order;
+        while (!layer.empty())
+        {
+            if (reversed) { res.insert(res.end(), layer.rbegin(), layer.rend()); }
+            else { res.insert(res.end(), layer.begin(), layer.end()); }
+            reversed = !reversed;
+            std::vector<int> next;
+            for (int node : layer) { for (int child : children[node]) { if (child >= 0) { next.push_back(child); } } }
+            layer.swap(next);
+        }
+        return res;
+    }
+
+    std::size_t maximum_depth() const
+    {
+        std::size_t res = 0;
+        for (int node : order<trl::depth_first_pre_order>())
+        {
+            std::size_t depth = 0;
+            for (int i = node; i >= 0; i = parent[i]) { ++depth; }
+            res = std::max(res, depth);
+        }
+        return res;
+    }
+};
+
+/* the traversals, reverse-iterators and node_traits of a tree against the model */
+template <typename Tree, std::size_t Size>
+bool matches_model(const Tree& tree, const n_ary_model<Size>& model)
+{
+    using traits_type = typename Tree::node_traits;
+    using iterator_type = typename Tree::template const_iterator<trl::depth_first_pre_order>;
+    bool ok = tree.size() == model.size && tree.empty() == !model.size && tree.maximum_depth() == model.maximum_depth()
+           && values<trl::depth_first_pre_order>(tree) == model.template order<trl::depth_first_pre_order>()
+           && values<trl::depth_first_post_order>(tree) == model.template order<trl::depth_first_post_order>()
+           && values<trl::breadth_first_in_order>(tree) == model.template order<trl::breadth_first_in_order>()
+           && values<trl::breadth_first_reverse_order>(tree) == model.template order<trl::breadth_first_reverse_order>()
+           && values_from_end<trl::depth_first_pre_order>(tree) == model.template order<trl::depth_first_pre_order>()
+           && values_from_end<trl::depth_first_post_order>(tree) == model.template order<trl::depth_first_post_order>();
+    std::vector<int> reversed(tree.template crbegin<trl::depth_first_post_order>(), tree.template crend<trl::depth_first_post_order>());
+    std::reverse(reversed.begin(), reversed.end());
+    ok = ok && reversed == model.template order<trl::depth_first_post_order>();
+    for (iterator_type i = tree.template cbegin<trl::depth_first_pre_order>(); ok && i != tree.template cend<trl::depth_first_pre_order>(); ++i)
+    {
+        const std::array<int, Size>& slots = model.children[*i];
+        std::vector<int> children;
+        for (std::size_t k = 0; k < Size; ++k)
+        {
+            ok = ok && traits_type::has_child(i, k) == (slots[k] >= 0);
+            if (slots[k] >= 0)
+            {
+                children.push_back(slots[k]);
+                ok = ok && *traits_type::child(i, k) == slots[k] && traits_type::slot(traits_type::child(i, k)) == k
+                        && traits_type::parent(traits_type::child(i, k)) == i;
+            }
+        }
+        ok = ok && !traits_type::has_child(i, Size) && traits_type::child_count(i) == children.size()
+                && traits_type::has_children(i) == !children.empty() && traits_type::is_root(traits_type::parent(i)) == (model.parent[*i] == -1);
+        if (!children.empty())
+        { ok = ok && std::vector<int>(traits_type::lbegin(i), traits_type::lend(i)) == children; }
+    }
+    return ok;
+}
+
+/* random insertions and erasures in random slots against a model of the slots */
+template <std::size_t Size>
+void check_n_ary_tree()
+{
+    using tree_type = trl::n_ary_tree<int, Size>;
+    using traits_type = typename tree_type::node_traits;
+
+    tree_type tree;
+    n_ary_model<Size> model;
+    CHECK(matches_model(tree, model) && tree.begin() == tree.end() && tree.maximum_depth() == 0);
+    std::mt19937 rng(static_cast<unsigned>(Size));
+    auto erase_and_check = [&]<trl::traversal Traversal>(int value, std::integral_constant<trl::traversal, Traversal>)
+    {
+        /* erase() returns the first node behind value that is not one of it's descendants */
+        std::vector<int> order = model.template order<Traversal>();
+        auto next = std::find(order.begin(), order.end(), value);
+        while (next != order.end() && model.below(*next, value)) { ++next; }
+        typename tree_type::template iterator<Traversal> res = tree.erase(typename tree_type::template iterator<Traversal>(find(tree, value)));
+        bool ok = next == order.end() ? res == tree.template end<Traversal>() : *res == *next;
+        model.erase(value);
+        return ok;
+    };
+
+    int next_value = 0;
+    for (int step = 0; step < 400; ++step)
+    {
+        std::vector<int> nodes = model.template order<trl::depth_first_pre_order>();
+        if (rng() % 4 || nodes.empty())
+        {
+            int where = nodes.empty() || rng() % 5 == 0 ? -1 : nodes[rng() % nodes.size()];
+            std::size_t slot = rng() % Size;
+            typename tree_type::template iterator<> parent = where < 0 ? tree.end() : find(tree, where);
+            if (model.slots_of(where)[slot] < 0)
+            {
+                CHECK(*tree.insert(parent, slot, next_value) == next_value);
+                model.insert(where, slot, next_value++);
+            }
+            else if constexpr (tree_type::policy_type::exceptions)
+            {
+                bool thrown = false;
+                try { tree.emplace(parent, slot, -1); } catch (const std::invalid_argument&) { thrown = true; }
+                CHECK(thrown);
+            }
+        }
+        else
+        {
+            int value = nodes[rng() % nodes.size()];
+            switch (step % 4)
+            {
+                case 0: CHECK(erase_and_check(value, std::integral_constant<trl::traversal, trl::depth_first_pre_order>{})); break;
+                case 1: CHECK(erase_and_check(value, std::integral_constant<trl::traversal, trl::depth_first_post_order>{})); break;
+                case 2: CHECK(erase_and_check(value, std::integral_constant<trl::traversal, trl::breadth_first_in_order>{})); break;
+                default: CHECK(erase_and_check(value, std::integral_constant<trl::traversal, trl::breadth_first_reverse_order>{})); break;
+            }
+        }
+        CHECK(matches_model(tree, model) && static_cast<std::size_t>(std::distance(tree.begin(), tree.end())) == tree.size());
+    }
+
+    /* slots out of range and empty slots */
+    if constexpr (tree_type::policy_type::exceptions)
+    {
+        tree = { { 1, { 2 } } };
+        bool thrown = false;
+        try { tree.insert(tree.begin(), Size, 3); } catch (const std::out_of_range&) { thrown = true; }
+        CHECK(thrown && tree.size() == 2);
+        thrown = false;
+        try { traits_type::child(tree.begin(), Size); } catch (const std::out_of_range&) { thrown = true; }
+        CHECK(thrown);
+        if constexpr (Size > 1)
+        {
+            thrown = false;
+            try { traits_type::child(tree.begin(), 1); } catch (const std::logic_error&) { thrown = true; }
+            CHECK(thrown && !traits_type::has_child(tree.begin(), 1));
+        }
+    }
+
+    /* copies keep every slot, moves and swaps take the nodes along */
+    tree.clear();
+    model = n_ary_model<Size>();
+    for (int value = 0; value < 30; ++value)
+    {
+        std::vector<int> nodes = model.template order<trl::depth_first_pre_order>();
+        int where = nodes.empty() ? -1 : nodes[rng() % nodes.size()];
+        std::size_t slot = rng() % Size;
+        if (model.slots_of(where)[slot] >= 0) { continue; }
+        tree.insert(where < 0 ? tree.end() : find(tree, where), slot, value);
+        model.insert(where, slot, value);
+    }
+    tree_type copy(tree);
+    CHECK(matches_model(copy, model) && matches_model(tree, model));
+    tree_type moved(std::move(copy));
+    CHECK(matches_model(moved, model) && copy.empty() && copy.begin() == copy.end());
+    tree_type other = { 100 };
+    swap(moved, other);
+    CHECK(matches_model(other, model) && moved.size() == 1 && *moved.begin() == 100);
+    moved = other;
+    other.clear();
+    CHECK(matches_model(moved, model) && other.empty() && other.maximum_depth() == 0);
+    other = std::move(moved);
+    CHECK(matches_model(other, model) && moved.empty());
+}
+
+/* the model of a complete tree of the values 0 ... count - 1, given in level-order */
+template <std::size_t Size>
+n_ary_model<Size> level_order_model(std::size_t count)
+{
+    n_ary_model<Size> model;
+    for (std::size_t i = 0; i < count; ++i)
+    { model.insert(i ? static_cast<int>((i - 1) / Size) : -1, i ? (i - 1) % Size : 0, static_cast<int>(i)); }
+    return model;
+}
+
+/* index-arithmetic, layers and the modifiers at the end of a flat_n_ary_tree against the model and an n_ary_tree of the same shape */
+template <std::size_t Size>
+void check_flat_n_ary_tree()
+{
+    using tree_type = trl::flat_n_ary_tree<int, Size>;
+    using traits_type = typename tree_type::node_traits;
+    using n_ary_type = trl::n_ary_tree<int, Size>;
+    constexpr trl::traversal in_order = trl::breadth_first_in_order;
+    constexpr trl::traversal reverse_order = trl::breadth_first_reverse_order;
+
+    tree_type tree;
+    n_ary_type equivalent;
+    auto same_as_equivalent = [&]()
+    {
+        return values<trl::depth_first_pre_order>(tree) == values<trl::depth_first_pre_order>(equivalent)
+            && values<trl::depth_first_post_order>(tree) == values<trl::depth_first_post_order>(equivalent)
+            && values<in_order>(tree) == values<in_order>(equivalent) && values<reverse_order>(tree) == values<reverse_order>(equivalent)
+            && values_from_end<in_order>(tree) == values<in_order>(tree) && values_from_end<reverse_order>(tree) == values<reverse_order>(tree)
+            && matches_model(tree, level_order_model<Size>(tree.size()));
+    };
+    CHECK(same_as_equivalent() && tree.begin() == tree.end() && tree.maximum_depth() == 0);
+    for (std::size_t i = 0; i < 60; ++i)
+    {
+        CHECK(*tree.push_back(static_cast<int>(i)) == static_cast<int>(i));
+        equivalent.insert(i ? find(equivalent, static_cast<int>((i - 1) / Size)) : equivalent.end(), i ? (i - 1) % Size : 0, static_cast<int>(i));
+        CHECK(same_as_equivalent());
+    }
+
+    /* the children of index i are at Size * i + 1 ... Size * i + Size, it's parent at (i - 1) / Size. the values are the indices. */
+    std::vector<int> indices(tree.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    CHECK(std::equal(indices.begin(), indices.end(), tree.data()));
+    for (typename tree_type::template iterator<trl::depth_first_pre_order> node = tree.begin(); node != tree.end(); ++node)
+    {
+        std::size_t i = static_cast<std::size_t>(*node), depth = 1;
+        for (std::size_t j = i; j; j = (j - 1) / Size) { ++depth; }
+        CHECK(traits_type::depth(node) == depth && &*node == tree.data() + i);
+        if (i) { CHECK(*traits_type::parent(node) == static_cast<int>((i - 1) / Size) && traits_type::slot(node) == (i - 1) % Size); }
+        else { CHECK(traits_type::is_root(traits_type::parent(node)) && traits_type::slot(node) == 0); }
+        for (std::size_t k = 0; k < Size; ++k)
+        {
+            CHECK(traits_type::has_child(node, k) == (Size * i + 1 + k < tree.size()));
+            if (traits_type::has_child(node, k)) { CHECK(*traits_type::child(node, k) == static_cast<int>(Size * i + 1 + k)); }
+        }
+    }
+    CHECK(*traits_type::child(tree.end(), 0) == 0 && !traits_type::has_child(tree.end(), 1));
+
+    /* every layer is a run of the level-order, only the deepest one is partially filled */
+    std::vector<int> joined;
+    std::size_t width = 1;
+    for (std::size_t depth = 1; depth <= tree.maximum_depth(); ++depth, width *= Size)
+    {
+        std::span<const int> layer = std::as_const(tree).layer(depth);
+        CHECK(layer.data() == tree.data() + joined.size() && tree.layer(depth).size() == layer.size());
+        CHECK(depth < tree.maximum_depth() ? layer.size() == width : layer.size() == tree.size() - joined.size() && (Size == 1 || layer.size() < width));
+        joined.insert(joined.end(), layer.begin(), layer.end());
+    }
+    CHECK(joined == indices);
+    if constexpr (tree_type::policy_type::exceptions)
+    {
+        for (std::size_t depth : { std::size_t{0}, tree.maximum_depth() + 1 })
+        {
+            bool thrown = false;
+            try { static_cast<void>(tree.layer(depth)); } catch (const std::out_of_range&) { thrown = true; }
+            CHECK(thrown);
+        }
+    }
+
+    /* breadth-first iterators step back from end() to begin() and over both ends */
+    typename tree_type::template iterator<in_order> last = --tree.template end<in_order>(), first = tree.template begin<in_order>();
+    CHECK(*last == values<in_order>(tree).back() && ++last == tree.template end<in_order>() && --first == tree.template end<in_order>());
+    typename tree_type::template iterator<reverse_order> rlast = --tree.template end<reverse_order>();
+    CHECK(*rlast == values<reverse_order>(tree).back() && ++rlast == tree.template end<reverse_order>());
+
+    /* shrinking and growing only at the end of the level-order */
+    while (tree.size() > 30)
+    {
+        equivalent.erase(find(equivalent, static_cast<int>(tree.size() - 1)));
+        tree.pop_back();
+        CHECK(same_as_equivalent());
+    }
+    tree.resize(10);
+    CHECK(matches_model(tree, level_order_model<Size>(10)));
+    tree.resize(25, -1);
+    CHECK(tree.size() == 25 && std::equal(indices.begin(), indices.begin() + 10, tree.data()) && std::count(tree.data() + 10, tree.data() + 25, -1) == 15);
+    tree.resize(0);
+    CHECK(tree.empty() && tree.maximum_depth() == 0 && tree.begin() == tree.end());
+    if constexpr (tree_type::policy_type::exceptions)
+    {
+        bool thrown = false;
+        try { tree.pop_back(); } catch (const std::logic_error&) { thrown = true; }
+        CHECK(thrown && tree.empty());
+    }
+    tree.push_back(0);
+    tree.resize(12);
+    CHECK(tree.size() == 12 && std::count(tree.data(), tree.data() + tree.size(), 0) == 12 && *--tree.end() == 0);
+}
+
+/* level-order indices of the perfect subtree of `height` layers below `root`, in van-emde-boas order: the upper half, then every subtree below it */
+template <std::size_t Size>
+void van_emde_boas_order(std::size_t root, std::size_t height, std::vector<int>& res)
+{
+    if (height == 1) { res.push_back(static_cast<int>(root)); return; }
+    std::size_t top = height / 2;
+    van_emde_boas_order<Size>(root, top, res);
+    std::vector<std::size_t> below{ root };
+    for (std::size_t depth = 0; depth < top; ++depth)
+    {
+        std::vector<std::size_t> next;
+        for (std::size_t node : below) { for (std::size_t k = 0; k < Size; ++k) { next.push_back(Size * node + 1 + k); } }
+        below.swap(next);
+    }
+    for (std::size_t node : below) { van_emde_boas_order<Size>(node, height - top, res); }
+}
+
+/* both layouts iterate identically while the van-emde-boas tree rearranges, and it stores the full layers in van-emde-boas order */
+template <std::size_t Size>
+void check_flat_layouts()
+{
+    using level_tree_type = trl::flat_n_ary_tree<int, Size>;
+    using veb_tree_type = trl::flat_n_ary_tree<int, Size, std::allocator<int>, veb_layout>;
+
+    /* the values are the level-order indices, the full layers come first in van-emde-boas order, the rest in level-order */
+    auto expected_storage = [](std::size_t count)
+    {
+        std::vector<int> res;
+        std::size_t height = 0, perfect = 0;
+        for (std::size_t width = 1; perfect + width <= count; width *= Size) { perfect += width; ++height; }
+        if (height) { van_emde_boas_order<Size>(0, height, res); }
+        for (std::size_t i = perfect; i < count; ++i) { res.push_back(static_cast<int>(i)); }
+        return res;
+    };
+    auto same_traversals = [](const level_tree_type& level, const veb_tree_type& veb)
+    {
+        auto reversed = []<trl::traversal Traversal, typename Tree>(const Tree& tree, std::integral_constant<trl::traversal, Traversal>)
+        { return std::vector<int>(tree.template crbegin<Traversal>(), tree.template crend<Traversal>()); };
+        return values<trl::depth_first_pre_order>(level) == values<trl::depth_first_pre_order>(veb)
+            && values<trl::depth_first_post_order>(level) == values<trl::depth_first_post_order>(veb)
+            && values<trl::breadth_first_in_order>(level) == values<trl::breadth_first_in_order>(veb)
+            && values<trl::breadth_first_reverse_order>(level) == values<trl::breadth_first_reverse_order>(veb)
+            && values_from_end<trl::depth_first_pre_order>(veb) == values<trl::depth_first_pre_order>(level)
+            && values_from_end<trl::breadth_first_in_order>(veb) == values<trl::breadth_first_in_order>(level)
+            && reversed(level, std::integral_constant<trl::traversal, trl::depth_first_pre_order>{})
+                == reversed(veb, std::integral_constant<trl::traversal, trl::depth_first_pre_order>{})
+            && reversed(level, std::integral_constant<trl::traversal, trl::depth_first_post_order>{})
+                == reversed(veb, std::integral_constant<trl::traversal, trl::depth_first_post_order>{})
+            && reversed(level, std::integral_constant<trl::traversal, trl::breadth_first_reverse_order>{})
+                == reversed(veb, std::integral_constant<trl::traversal, trl::breadth_first_reverse_order>{})
+            && level.maximum_depth() == veb.maximum_depth() && level.size() == veb.size();
+    };
+
+    /* perfect trees of every height that fits, then one node more */
+    for (std::size_t count = 1, width = 1; count < 400; width *= Size, count += width)
+    {
+        std::vector<int> indices(count + 1);
+        std::iota(indices.begin(), indices.end(), 0);
+        veb_tree_type veb(indices.begin(), indices.end() - 1);
+        level_tree_type level(indices.begin(), indices.end() - 1);
+        CHECK(std::vector<int>(veb.data(), veb.data() + veb.size()) == expected_storage(count) && same_traversals(level, veb));
+        veb.push_back(static_cast<int>(count));
+        level.push_back(static_cast<int>(count));
+        CHECK(std::vector<int>(veb.data(), veb.data() + veb.size()) == expected_storage(count + 1) && same_traversals(level, veb));
+        if constexpr (Size == 1) { if (count > 20) { break; } }
+    }
+
+    /* random walks up and down the level-order, filling and emptying layers on the way */
+    level_tree_type level;
+    veb_tree_type veb;
+    std::mt19937 rng(static_cast<unsigned>(Size) + 18);
+    for (int walk = 0; walk < 6; ++walk)
+    {
+        std::size_t target = rng() % 160;
+        while (level.size() != target)
+        {
+            bool grow = level.size() < target ? rng() % 4 != 0 : rng() % 4 == 0;
+            if (grow || level.empty())
+            {
+                CHECK(*veb.push_back(static_cast<int>(veb.size())) == *level.push_back(static_cast<int>(level.size())));
+            }
+            else
+            {
+                level.pop_back();
+                veb.pop_back();
+            }
+            CHECK(std::vector<int>(veb.data(), veb.data() + veb.size()) == expected_storage(veb.size()) && same_traversals(level, veb));
+        }
+        std::size_t count = rng() % 160, kept = std::min(count, level.size());
+        level.resize(count, -1);
+        veb.resize(count, -1);
+        CHECK(same_traversals(level, veb) && static_cast<std::size_t>(std::count(veb.data(), veb.data() + veb.size(), -1)) == count - kept);
+        level.resize(kept);
+        veb.resize(kept);
+        CHECK(std::vector<int>(veb.data(), veb.data() + veb.size()) == expected_storage(kept) && same_traversals(level, veb));
+    }
+}
 
 int main(int argc, char** argv)
 {
     using namespace trl;
+
+    check_modifiers<flex_tree_policy>();
+    check_modifiers<sibling_links>();
+    check_modifiers<sized_subtrees>();
+    check_modifiers<forward_links>();
+    check_node_layout();
+    check_default_policy();
+    check_depths<flex_tree_policy>();
+    check_depths<counted_depths>();
+    check_pool_allocator();
+    check_pool_release();
+    check_move_and_swap<flex_tree_policy>();
+    check_move_and_swap<sized_subtrees>();
+    check_initializer_list<flex_tree_policy>();
+    check_initializer_list<sibling_links>();
+    check_initializer_list<sized_subtrees>();
+    check_rvalue_insertion();
+    check_breadth_first<flex_tree_policy>();
+    check_breadth_first<sibling_links>();
+    check_breadth_first<counted_depths>();
+    check_deepest_layer<flex_tree_policy>();
+    check_deepest_layer<counted_depths>();
+    check_deepest_layer<sized_subtrees>();
+    check_freeze();
+    check_ancestor_table<flex_tree_policy>();
+    check_ancestor_table<sibling_links>();
+    check_is_ancestor<flex_tree_policy>();
+    check_is_ancestor<sized_subtrees>();
+    check_compact<flex_tree_policy>();
+    check_compact<sibling_links>();
+    check_compact<sized_subtrees>();
+    check_compact<counted_depths>();
+    check_nth<sized_subtrees>();
+    check_sample<sized_subtrees>();
+    check_n_ary_tree<2>();
+    check_n_ary_tree<3>();
+    check_n_ary_tree<8>();
+    check_flat_n_ary_tree<1>();
+    check_flat_n_ary_tree<2>();
+    check_flat_n_ary_tree<3>();
+    check_flat_n_ary_tree<4>();
+    check_flat_layouts<1>();
+    check_flat_layouts<2>();
+    check_flat_layouts<3>();
+    check_flat_layouts<4>();
+
     using tree_type = flex_tree<std::string>;
     /* type to retrieve information about nodes */
     using traits_type = tree_type::node_traits;
@@ -54,11 +1465,28 @@ int main(int argc, char** argv)
     for (tree_type::iterator i = ftr.begin(); i != ftr.end(); ++i)
     { std::cout << std::string(traits_type::depth(i), '-') << *i << '\n'; }
 
+    /* depth-first post-order traversal, every node comes after it's children */
+    std::cout << "depth-first post-order:\n";
+    for (tree_type::iterator<depth_first_post_order> i = ftr.begin<depth_first_post_order>(); i != ftr.end<depth_first_post_order>(); ++i)
+    { std::cout << std::string(traits_type::depth(i), '-') << *i << '\n'; }
+
     /* breadth-first traversal */
     std::cout << "breadth-first:\n";
     for (tree_type::iterator<breadth_first_in_order> i = ftr.begin(); i != ftr.end(); ++i)
     { std::cout << std::string(traits_type::depth(i), '-') << *i << '\n'; }
 
+    /* breadth-first traversal, starting right-to-left */
+    std::cout << "breadth-first reverse-order:\n";
+    for (tree_type::iterator<breadth_first_reverse_order> i = ftr.begin<breadth_first_reverse_order>(); i != ftr.end<breadth_first_reverse_order>(); ++i)
+    { std::cout << std::string(traits_type::depth(i), '-') << *i << '\n'; }
+
+    /* a tree that only links siblings: cheaper modifications, breadth-first iteration keeps a queue of the current layer */
+    using sibling_tree_type = flex_tree<std::string, std::allocator<std::string>, sibling_links>;
+    sibling_tree_type str = { { "hello", { "world", "foo" } }, { "bar", { "bogus", "iltam" } } };
+    std::cout << "breadth-first without layer-links:\n";
+    for (sibling_tree_type::iterator<breadth_first_in_order> i = str.begin<breadth_first_in_order>(); i != str.end<breadth_first_in_order>(); ++i)
+    { std::cout << std::string(sibling_tree_type::node_traits::depth(i), '-') << *i << '\n'; }
+
     /* searching for a value and replacing it. will use depth-first as default. */
     *std::find(ftr.begin(), ftr.end(), "bogus") = "sugob";
 
@@ -68,5 +1496,82 @@ int main(int argc, char** argv)
     for (tree_type::const_leaf_iterator cl = traits_type::lbegin(i); cl != traits_type::lend(i); ++cl)
     { std::cout << std::string(traits_type::depth(cl), '-') << *cl << '\n'; }
 
-    return 0;
+    /* the same tree in contiguous pre-order arrays, built from the node-based one */
+    using flat_tree_type = flat_flex_tree<std::string>;
+    flat_tree_type fft(ftr);
+    std::cout << "flat breadth-first:\n";
+    for (flat_tree_type::iterator<breadth_first_in_order> i = fft.begin<breadth_first_in_order>(); i != fft.end<breadth_first_in_order>(); ++i)
+    { std::cout << std::string(flat_tree_type::node_traits::depth(i), '-') << *i << " (" << flat_tree_type::node_traits::subtree_size(i) << " nodes)\n"; }
+
+    /* and back into nodes */
+    tree_type rtr = fft.to_flex_tree();
+    std::cout << "flat round-trip:\n";
+    for (tree_type::iterator i = rtr.begin(); i != rtr.end(); ++i)
+    { std::cout << std::string(traits_type::depth(i), '-') << *i << '\n'; }
+
+    /* the same tree again, keeping the size of every subtree up to date */
+    using sized_tree_type = flex_tree<std::string, std::allocator<std::string>, sized_subtrees>;
+    sized_tree_type sized = fft.to_flex_tree<std::allocator<std::string>, sized_subtrees>();
+    sized.splice_append(sized.begin(), std::next(sized.begin()));
+    std::cout << "subtree-sizes after splicing 'world' below 'hello':\n";
+    for (sized_tree_type::iterator i = sized.begin(); i != sized.end(); ++i)
+    { std::cout << std::string(sized_tree_type::node_traits::depth(i), '-') << *i << " (" << sized_tree_type::node_traits::subtree_size(i) << ")\n"; }
+    /* which also allows positional access without iterating over the nodes in front */
+    sized_tree_type::iterator<depth_first_post_order> fifth = sized.nth<depth_first_post_order>(4);
+    std::cout << "5th node in post-order: " << *fifth << " (index " << sized.index_of(fifth) << ")\n";
+    std::mt19937 rng(42);
+    sized_tree_type::iterator<> bar = std::find(sized.begin(), sized.end(), "bar");
+    std::cout << "random node in the subtree of 'bar': " << *sized.sample_in_subtree(bar, rng) << '\n';
+    sized_tree_type::iterator<> below_bar = sized_tree_type::node_traits::first_child(bar);
+    std::cout << "'hello' / 'bar' is an ancestor of '" << *below_bar << "': "
+              << (sized_tree_type::node_traits::is_ancestor(sized.begin(), below_bar) ? "yes" : "no") << " / "
+              << (sized_tree_type::node_traits::is_ancestor(bar, below_bar) ? "yes" : "no") << '\n';
+    /* lowest common ancestors and ancestors on a depth, without walking up */
+    ancestor_table<std::string, std::allocator<std::string>, sized_subtrees> ancestors(sized);
+    sized_tree_type::iterator<> last = std::prev(sized.end());
+    std::cout << "lowest common ancestor of '" << *below_bar << "' and '" << *last << "': " << *ancestors.lca(below_bar, last)
+              << ", top-level node above '" << *last << "': " << *ancestors.ancestor_at_depth(last, 1) << '\n';
+
+    /* an immutable snapshot to serve read-only, thawed back into nodes to edit it again */
+    using frozen_tree_type = frozen_flex_tree<std::string>;
+    frozen_tree_type snapshot = freeze(ftr);
+    std::cout << "leaves of the frozen snapshot:";
+    for (frozen_tree_type::const_leaf_iterator cl = frozen_tree_type::node_traits::lbegin(snapshot.cend()); cl != frozen_tree_type::node_traits::lend(snapshot.cend()); ++cl)
+    { std::cout << ' ' << *cl; }
+    tree_type thawed = thaw(snapshot);
+    thawed.append(thawed.end(), "thawed");
+    std::cout << "\nthawed and appended to: " << thawed.size() << " nodes\n";
+
+    /* a binary tree: every node has two child-slots, which can be empty */
+    using binary_tree_type = n_ary_tree<std::string, 2>;
+    using binary_traits_type = binary_tree_type::node_traits;
+    binary_tree_type btr = { { "root", { "left", "right" } } };
+    auto right = binary_traits_type::child(btr.begin(), 1);
+    btr.insert(right, 1, "right-right");
+    std::cout << "binary-tree, descending to the right:\n";
+    for (auto i = btr.begin(); !binary_traits_type::is_root(i); i = binary_traits_type::has_child(i, 1) ? binary_traits_type::child(i, 1) : btr.end())
+    { std::cout << std::string(binary_traits_type::depth(i), '-') << *i << '\n'; }
+
+    /* a complete binary tree without any links, given in level-order. sums up every subtree layer by layer. */
+    using heap_type = flat_n_ary_tree<int, 2>;
+    heap_type htr = { 1, 2, 3, 4, 5, 6, 7 };
+    for (std::size_t depth = htr.maximum_depth(); depth > 1; --depth)
+    {
+        std::span<int> children = htr.layer(depth), parents = htr.layer(depth - 1);
+        for (std::size_t i = 0; i < children.size(); ++i)
+        { parents[i / 2] += children[i]; }
+    }
+    std::cout << "subtree-sums of a complete binary tree:\n";
+    for (heap_type::iterator i = htr.begin(); i != htr.end(); ++i)
+    { std::cout << std::string(heap_type::node_traits::depth(i), '-') << *i << '\n'; }
+
+    /* the same tree in van-emde-boas order. iterates identically, only the storage-order differs. */
+    using veb_heap_type = flat_n_ary_tree<int, 2, std::allocator<int>, veb_layout>;
+    veb_heap_type vtr(htr.data(), htr.data() + htr.size());
+    std::cout << "van-emde-boas storage-order:";
+    for (std::size_t i = 0; i < vtr.size(); ++i)
+    { std::cout << ' ' << vtr.data()[i]; }
+    std::cout << '\n';
+
+    return failed_checks ? 1 : 0;
 }
\ No newline at end of file